@@ -1,128 +1,767 @@
-/* APIGraphic Implementation - Translation Layer
- *
- * APIGraphic.cpp
- * fwk4gps version 3.0
- * gam666/dps901/gam670/dps905
- * January 14 2012
- * copyright (c) 2012 Chris Szalwinski 
- * distributed under TPL - see ../Licenses.txt
- */
-
-#include "APIGraphic.h"     // for the APIGraphic class definition
-#include "iGraphic.h"       // for the Graphic Interface
-#include "APIVertex.h"      // for Vertex static variables
-#include "Common_Symbols.h" // symbols common to Modelling/Translation layer
-
-//-------------------------------- APIVertexList ------------------------------
-//
-// The APIVertexList class hierarchy implements the Vertex List at the API
-// level
-//
-// CreateAPIVertexList creates the APIVertexList object on dynamic memory
-//
-iAPIGraphic* CreateAPIVertexList(PrimitiveType t, unsigned n, unsigned s, 
- unsigned f, iGraphic* v) {
-
-    return new APIVertexList(t, n, s, f, v);
-}
-
-// constructor initializes instance variables and converts to the API types
-//
-APIVertexList::APIVertexList(PrimitiveType t, unsigned np, unsigned s,
- unsigned f, iGraphic* v) : nPrimitives(np), vertexList(v), vb(nullptr), 
- vertexSize(s), vertexFrmt(f), nVertices(0) {
-
-    // convert to Direct3D type
-    switch (t) {
-        case POINT_LIST    : type = D3DPT_POINTLIST;     break;
-        case LINE_LIST     : type = D3DPT_LINELIST;      break;
-        case LINE_STRIP    : type = D3DPT_LINESTRIP;     break;
-        case TRIANGLE_LIST : type = D3DPT_TRIANGLELIST;  break;
-        case TRIANGLE_STRIP: type = D3DPT_TRIANGLESTRIP; break;
-        case TRIANGLE_FAN  : type = D3DPT_TRIANGLEFAN;   break;
-        default            : type = D3DPT_POINTLIST;
-    }
-}
-
-APIVertexList::APIVertexList(const APIVertexList& src) {
-    
-    vb    = nullptr;
-    *this = src;
-}
-
-APIVertexList& APIVertexList::operator=(const APIVertexList& src) {
-
-    if (this != &src) {
-        vertexList  = src.vertexList;
-        vertexSize  = src.vertexSize;
-        vertexFrmt  = src.vertexFrmt;
-        nPrimitives = src.nPrimitives;
-        type        = src.type;
-        if (vb) {
-            vb->Release();
-            vb = nullptr;
-        }
-    }
-
-    return *this;
-}
-
-// setup creates the vertex buffer and populates it
-//
-void APIVertexList::setup(unsigned n) {
-
-    nVertices = n;
-
-	// create the vertex buffer
-    if (FAILED(d3dd->CreateVertexBuffer(vertexSize * n, 0, vertexFrmt, 
-     D3DPOOL_DEFAULT, &vb, nullptr))) {
-        error(L"APIVertexList::10 Couldn\'t create the vertex buffer");
-        vb = nullptr;
-    }
-    // populate the newly created vertex buffer
-    else {
-        void* pv;
-        if (SUCCEEDED(vb->Lock(0, vertexSize * n, &pv, 0)))
-            for (unsigned i = 0; i < n; i++)
-                vertexList->populate(i, &pv);
-        vb->Unlock();
-    }
-}
-
-// draw draws the stream of vertices
-//
-void APIVertexList::draw(unsigned n) {
-
-    if (!vb) setup(n);
-
-    if (vb) {
-        d3dd->SetFVF(vertexFrmt);
-        d3dd->SetStreamSource(0, vb, 0, vertexSize);
-        d3dd->DrawPrimitive(type, 0, nPrimitives);
-    }
-}
-
-// suspend releases the interface to the vertex buffer
-//
-void APIVertexList::suspend() {
-
-    if (vb) {
-        vb->Release();
-        vb = nullptr;
-    }
-}
-
-// release suspends the vertex buffer
-//
-void APIVertexList::release() {
-
-    suspend();
-}
-
-// destructor releases the vertex buffer
-//
-APIVertexList::~APIVertexList() {
-
-    release();
-}
-
+/* APIGraphic Implementation - Translation Layer
+ *
+ * APIGraphic.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "APIGraphic.h"     // for the APIGraphic class definition
+#include "iGraphic.h"       // for the Graphic Interface
+#include "APIVertex.h"      // for Vertex static variables
+#include "iAPIDisplay.h"    // for the APIDisplay Interface
+#include "Common_Symbols.h" // symbols common to Modelling/Translation layer
+
+// d3dType converts primitive type t to the Direct3D type
+//
+static D3DPRIMITIVETYPE d3dType(PrimitiveType t) {
+
+    switch (t) {
+        case POINT_LIST    : return D3DPT_POINTLIST;
+        case LINE_LIST     : return D3DPT_LINELIST;
+        case LINE_STRIP    : return D3DPT_LINESTRIP;
+        case TRIANGLE_LIST : return D3DPT_TRIANGLELIST;
+        case TRIANGLE_STRIP: return D3DPT_TRIANGLESTRIP;
+        case TRIANGLE_FAN  : return D3DPT_TRIANGLEFAN;
+        default            : return D3DPT_POINTLIST;
+    }
+}
+
+//-------------------------------- APIVertexList ------------------------------
+//
+// The APIVertexList class hierarchy implements the Vertex List at the API
+// level
+//
+// CreateAPIVertexList creates the APIVertexList object on dynamic memory
+//
+iAPIGraphic* CreateAPIVertexList(PrimitiveType t, unsigned n, unsigned s, 
+ unsigned f, iGraphic* v) {
+
+    return new APIVertexList(t, n, s, f, v);
+}
+
+// constructor initializes instance variables and converts to the API types
+//
+APIVertexList::APIVertexList(PrimitiveType t, unsigned np, unsigned s,
+ unsigned f, iGraphic* v) : nPrimitives(np), vertexList(v), vb(nullptr), 
+ vertexSize(s), vertexFrmt(f), nVertices(0), ib(nullptr), nIndices(0) {
+
+    type = d3dType(t);
+}
+
+APIVertexList::APIVertexList(const APIVertexList& src) {
+    
+    vb    = nullptr;
+    ib    = nullptr;
+    *this = src;
+}
+
+APIVertexList& APIVertexList::operator=(const APIVertexList& src) {
+
+    if (this != &src) {
+        vertexList  = src.vertexList;
+        vertexSize  = src.vertexSize;
+        vertexFrmt  = src.vertexFrmt;
+        nPrimitives = src.nPrimitives;
+        type        = src.type;
+        release();
+    }
+
+    return *this;
+}
+
+// setup creates the vertex buffer in the managed pool and has the vertex
+// list copy its vertices into it in the device format along with the index
+// buffer for an indexed list - 16-bit indices if they can address all of
+// the vertices, otherwise 32-bit indices
+//
+void APIVertexList::setup(unsigned n) {
+
+    nVertices = n;
+    nIndices  = vertexList->noIndices();
+
+	// create the vertex buffer
+    if (FAILED(d3dd->CreateVertexBuffer(vertexSize * n, D3DUSAGE_WRITEONLY,
+     vertexFrmt, D3DPOOL_MANAGED, &vb, nullptr))) {
+        error(L"APIVertexList::10 Couldn\'t create the vertex buffer");
+        vb = nullptr;
+    }
+    // copy the vertices into the newly created vertex buffer - the buffer
+    // is write-only so the copy streams straight through
+    else {
+        void* pv;
+        if (SUCCEEDED(vb->Lock(0, vertexSize * n, &pv, 0))) {
+            vertexList->upload(pv, n);
+            vb->Unlock();
+        }
+    }
+
+    if (vb && nIndices) {
+        bool     wide = n > 0xFFFF;
+        unsigned size = nIndices * (wide ? 4 : 2);
+        void*    pi;
+        if (FAILED(d3dd->CreateIndexBuffer(size, D3DUSAGE_WRITEONLY, 
+         wide ? D3DFMT_INDEX32 : D3DFMT_INDEX16, D3DPOOL_MANAGED, &ib, 
+         nullptr))) {
+            error(L"APIVertexList::11 Couldn\'t create the index buffer");
+            ib = nullptr;
+            vb->Release();
+            vb = nullptr;
+        }
+        else if (SUCCEEDED(ib->Lock(0, size, &pi, 0))) {
+            if (wide)
+                for (unsigned i = 0; i < nIndices; i++)
+                    ((unsigned*)pi)[i] = vertexList->index(i);
+            else
+                for (unsigned i = 0; i < nIndices; i++)
+                    ((unsigned short*)pi)[i] = 
+                     (unsigned short)vertexList->index(i);
+            ib->Unlock();
+        }
+    }
+}
+
+// prepare creates the buffers for n vertices ahead of the first draw -
+// returns true if it created them
+//
+bool APIVertexList::prepare(unsigned n) {
+
+    if (vb || !n) return false;
+    setup(n);
+
+    return vb != nullptr;
+}
+
+// draw draws the stream of vertices
+//
+void APIVertexList::draw(unsigned n) {
+
+    if (!vb) setup(n);
+
+    if (vb) {
+        d3dd->SetFVF(vertexFrmt);
+        d3dd->SetStreamSource(0, vb, 0, vertexSize);
+        if (ib) {
+            d3dd->SetIndices(ib);
+            d3dd->DrawIndexedPrimitive(type, 0, 0, nVertices, 0, nPrimitives);
+        }
+        else
+            d3dd->DrawPrimitive(type, 0, nPrimitives);
+    }
+}
+
+// draw draws the stream of vertices once for each of the nw world 
+// transformations packed at world - binds the stream once for all copies
+//
+void APIVertexList::draw(unsigned n, const void* world, unsigned nw) {
+
+    if (!vb) setup(n);
+
+    if (vb) {
+        const D3DXMATRIX* w = (const D3DXMATRIX*)world;
+        d3dd->SetFVF(vertexFrmt);
+        d3dd->SetStreamSource(0, vb, 0, vertexSize);
+        if (ib) d3dd->SetIndices(ib);
+        for (unsigned i = 0; i < nw; i++) {
+            display->setWorld(&w[i]);
+            if (ib)
+                d3dd->DrawIndexedPrimitive(type, 0, 0, nVertices, 0, 
+                 nPrimitives);
+            else
+                d3dd->DrawPrimitive(type, 0, nPrimitives);
+        }
+    }
+}
+
+// suspend keeps the vertex and index buffers - the managed pool restores
+// them after a device reset without another upload
+//
+void APIVertexList::suspend() {
+
+}
+
+// release releases the interfaces to the vertex and index buffers
+//
+void APIVertexList::release() {
+
+    if (vb) {
+        vb->Release();
+        vb = nullptr;
+    }
+    if (ib) {
+        ib->Release();
+        ib = nullptr;
+    }
+}
+
+// destructor releases the vertex buffer
+//
+APIVertexList::~APIVertexList() {
+
+    release();
+}
+
+
+
+//-------------------------------- APIDynamicList -----------------------------
+//
+// The APIDynamicList class streams vertex lists that change every frame
+// through a ring buffer shared by all of them
+//
+IDirect3DVertexBuffer9* APIDynamicList::ring      = nullptr;
+IDirect3DQuery9*        APIDynamicList::fence[STREAM_FRAMES];
+unsigned                APIDynamicList::fenceMark[STREAM_FRAMES];
+unsigned                APIDynamicList::nFences   = 0;
+unsigned                APIDynamicList::oldest    = 0;
+unsigned                APIDynamicList::head      = 0;
+unsigned                APIDynamicList::written   = 0;
+unsigned                APIDynamicList::retired   = 0;
+unsigned                APIDynamicList::streamed  = 0;
+unsigned                APIDynamicList::lastFrame = 0;
+unsigned                APIDynamicList::stalls    = 0;
+
+// CreateAPIDynamicList creates the APIDynamicList object on dynamic memory
+//
+iAPIGraphic* CreateAPIDynamicList(PrimitiveType t, unsigned s, unsigned f, 
+ iGraphic* v) {
+
+    return new APIDynamicList(t, s, f, v);
+}
+
+// constructor initializes the instance variables - the ring is created by
+// the first draw of any dynamic list
+//
+APIDynamicList::APIDynamicList(PrimitiveType t, unsigned s, unsigned f, 
+ iGraphic* v) : type(d3dType(t)), vertexList(v), vertexSize(s), 
+ vertexFrmt(f), vb(nullptr), capacity(0), ib(nullptr), nIndices(0), 
+ reported(false) {}
+
+APIDynamicList::APIDynamicList(const APIDynamicList& src) {
+
+    vb       = nullptr;
+    capacity = 0;
+    ib       = nullptr;
+    *this    = src;
+}
+
+APIDynamicList& APIDynamicList::operator=(const APIDynamicList& src) {
+
+    if (this != &src) {
+        type       = src.type;
+        vertexList = src.vertexList;
+        vertexSize = src.vertexSize;
+        vertexFrmt = src.vertexFrmt;
+        reported   = false;
+        release();
+    }
+
+    return *this;
+}
+
+// setup creates the ring in the default pool and the end of frame events -
+// the ring works without the events, discarding its contents whenever it 
+// fills, if the device does not support them - returns true if the ring
+// exists
+//
+bool APIDynamicList::setup() {
+
+    if (!ring) {
+        if (FAILED(d3dd->CreateVertexBuffer(STREAM_SIZE, D3DUSAGE_DYNAMIC | 
+         D3DUSAGE_WRITEONLY, 0, D3DPOOL_DEFAULT, &ring, nullptr))) {
+            if (!reported)
+                error(L"APIDynamicList::10 Couldn\'t create the vertex "
+                 L"stream");
+            reported = true;
+            ring     = nullptr;
+        }
+        else {
+            bool events = true;
+            for (unsigned i = 0; i < STREAM_FRAMES; i++) {
+                HRESULT hr = d3dd->CreateQuery(D3DQUERYTYPE_EVENT, &fence[i]);
+                if (FAILED(hr)) {
+                    fence[i] = nullptr;
+                    events   = false;
+                }
+            }
+            for (unsigned i = 0; i < STREAM_FRAMES && !events; i++)
+                if (fence[i]) {
+                    fence[i]->Release();
+                    fence[i] = nullptr;
+                }
+            head    = 0;
+            written = 0;
+            retired = 0;
+            nFences = 0;
+            oldest  = 0;
+        }
+    }
+
+    return ring != nullptr;
+}
+
+// setup creates the list's own dynamic vertex buffer in the default pool 
+// for a list of n vertices that is too large for the ring - an error is 
+// reported once rather than on every draw
+//
+void APIDynamicList::setup(unsigned n) {
+
+    if (vb) {
+        vb->Release();
+        vb = nullptr;
+    }
+    if (FAILED(d3dd->CreateVertexBuffer(vertexSize * n, D3DUSAGE_DYNAMIC |
+     D3DUSAGE_WRITEONLY, vertexFrmt, D3DPOOL_DEFAULT, &vb, nullptr))) {
+        if (!reported)
+            error(L"APIDynamicList::11 Couldn\'t create the vertex buffer");
+        reported = true;
+        vb       = nullptr;
+        capacity = 0;
+    }
+    else
+        capacity = n;
+}
+
+// setupIndices creates the index buffer in the managed pool for a list of
+// n vertices that has indices - 16-bit indices if they can address all of
+// the vertices, otherwise 32-bit indices - returns false if the list has
+// indices but the buffer could not be created
+//
+bool APIDynamicList::setupIndices(unsigned n) {
+
+    if (ib || !vertexList->noIndices()) return true;
+
+    nIndices      = vertexList->noIndices();
+    bool     wide = n > 0x10000;
+    unsigned size = nIndices * (wide ? 4 : 2);
+    void*    pi;
+    if (FAILED(d3dd->CreateIndexBuffer(size, D3DUSAGE_WRITEONLY, 
+     wide ? D3DFMT_INDEX32 : D3DFMT_INDEX16, D3DPOOL_MANAGED, &ib, 
+     nullptr))) {
+        if (!reported)
+            error(L"APIDynamicList::12 Couldn\'t create the index buffer");
+        reported = true;
+        ib       = nullptr;
+        nIndices = 0;
+    }
+    else if (SUCCEEDED(ib->Lock(0, size, &pi, 0))) {
+        if (wide)
+            for (unsigned i = 0; i < nIndices; i++)
+                ((unsigned*)pi)[i] = vertexList->index(i);
+        else
+            for (unsigned i = 0; i < nIndices; i++)
+                ((unsigned short*)pi)[i] = 
+                 (unsigned short)vertexList->index(i);
+        ib->Unlock();
+    }
+
+    return ib != nullptr;
+}
+
+// primitives returns the number of primitives drawn by n vertices
+//
+unsigned APIDynamicList::primitives(unsigned n) const {
+
+    switch (type) {
+        case D3DPT_LINELIST     : return n / 2;
+        case D3DPT_LINESTRIP    : return n > 1 ? n - 1 : 0;
+        case D3DPT_TRIANGLELIST : return n / 3;
+        case D3DPT_TRIANGLESTRIP:
+        case D3DPT_TRIANGLEFAN  : return n > 2 ? n - 2 : 0;
+        default                 : return n;
+    }
+}
+
+// retire moves the mark of the bytes that the device has finished reading
+// past each frame whose event has been signalled - if wait is true, first
+// waits for the oldest unfinished frame
+//
+void APIDynamicList::retire(bool wait) {
+
+    if (wait && nFences) {
+        stalls++;
+        while (fence[oldest]->GetData(nullptr, 0, D3DGETDATA_FLUSH) == 
+         S_FALSE)
+            ;
+        retired = fenceMark[oldest];
+        oldest  = (oldest + 1) % STREAM_FRAMES;
+        nFences--;
+    }
+    while (nFences && fence[oldest]->GetData(nullptr, 0, 0) != S_FALSE) {
+        retired = fenceMark[oldest];
+        oldest  = (oldest + 1) % STREAM_FRAMES;
+        nFences--;
+    }
+}
+
+// reserve locks space for n vertices in the ring and stores the index of
+// the first of them in first - the space starts on a multiple of the
+// vertex size so that the list draws from a vertex index without a stream
+// offset - returns nullptr if the space could not be locked
+//
+void* APIDynamicList::reserve(unsigned n, unsigned& first) {
+
+    unsigned bytes = n * vertexSize;
+
+    // place the vertices after the last write or at the start of the ring
+    // if they do not fit before its end - the bytes skipped count as used
+    unsigned start = (head + vertexSize - 1) / vertexSize * vertexSize;
+    unsigned skip  = start - head;
+    if (start + bytes > STREAM_SIZE) {
+        start = 0;
+        skip  = STREAM_SIZE - head;
+    }
+    unsigned need  = skip + bytes;
+
+    // wait for the frames that the device is still reading from the space
+    retire(false);
+    while (need > STREAM_SIZE - (written - retired) && nFences)
+        retire(true);
+
+    // if the frame being drawn fills the ring by itself, start a new one -
+    // the device keeps reading the old one and no earlier frame is pending
+    DWORD flags = D3DLOCK_NOOVERWRITE;
+    if (need > STREAM_SIZE - (written - retired)) {
+        flags   = D3DLOCK_DISCARD;
+        start   = 0;
+        need    = bytes;
+        retired = written;
+        nFences = 0;
+    }
+
+    void* pv;
+    if (FAILED(ring->Lock(start, bytes, &pv, flags)))
+        return nullptr;
+    written  += need;
+    head      = start + bytes;
+    streamed += bytes;
+    first     = start / vertexSize;
+
+    return pv;
+}
+
+// lock locks space for n vertices in the ring, or in the list's own
+// buffer if they would not fit in the ring, stores the buffer in b and the
+// index of the first vertex in first - returns nullptr if the space could
+// not be locked
+//
+void* APIDynamicList::lock(unsigned n, unsigned& first,
+ IDirect3DVertexBuffer9*& b) {
+
+    void* pv = nullptr;
+    if (n <= STREAM_SIZE / vertexSize) {
+        pv = setup() ? reserve(n, first) : nullptr;
+        b  = ring;
+    }
+    else {
+        if (!vb || n > capacity) setup(n);
+        b     = vb;
+        first = 0;
+        if (!vb || FAILED(vb->Lock(0, vertexSize * n, &pv, 
+         D3DLOCK_DISCARD)))
+            pv = nullptr;
+        else
+            streamed += vertexSize * n;
+    }
+
+    return pv;
+}
+
+// prepare creates the shared ring, or the list's own buffer for a list of
+// n vertices that is too large for the ring, and the index buffer of an 
+// indexed list ahead of the first draw - returns true if it created any
+//
+bool APIDynamicList::prepare(unsigned n) {
+
+    bool created = !ib && vertexList->noIndices() && setupIndices(n);
+    if (n > STREAM_SIZE / vertexSize) {
+        if (!vb) setup(n);
+        created = created || vb != nullptr;
+    }
+    else if (!ring)
+        created = setup() || created;
+
+    return created;
+}
+
+// render draws the n vertices streamed from index first - through the
+// index buffer for an indexed list
+//
+void APIDynamicList::render(unsigned first, unsigned n) const {
+
+    if (ib)
+        d3dd->DrawIndexedPrimitive(type, first, 0, n, 0, 
+         primitives(nIndices));
+    else
+        d3dd->DrawPrimitive(type, first, primitives(n));
+}
+
+// draw has the vertex list write its n vertices into the ring, or into its
+// own buffer, and draws them
+//
+void APIDynamicList::draw(unsigned n) {
+
+    IDirect3DVertexBuffer9* b;
+    unsigned first;
+    void*    pv;
+    if (n && setupIndices(n) && (pv = lock(n, first, b)) != nullptr) {
+        vertexList->upload(pv, n);
+        b->Unlock();
+        d3dd->SetFVF(vertexFrmt);
+        d3dd->SetStreamSource(0, b, 0, vertexSize);
+        if (ib) d3dd->SetIndices(ib);
+        render(first, n);
+    }
+}
+
+// draw writes the n vertices into the stream once and draws them once for
+// each of the nw world transformations packed at world
+//
+void APIDynamicList::draw(unsigned n, const void* world, unsigned nw) {
+
+    IDirect3DVertexBuffer9* b;
+    unsigned first;
+    void*    pv;
+    if (n && nw && setupIndices(n) && (pv = lock(n, first, b)) != nullptr) {
+        const D3DXMATRIX* w = (const D3DXMATRIX*)world;
+        vertexList->upload(pv, n);
+        b->Unlock();
+        d3dd->SetFVF(vertexFrmt);
+        d3dd->SetStreamSource(0, b, 0, vertexSize);
+        if (ib) d3dd->SetIndices(ib);
+        for (unsigned i = 0; i < nw; i++) {
+            display->setWorld(&w[i]);
+            render(first, n);
+        }
+    }
+}
+
+// suspend releases the list's own buffer - a buffer in the default pool 
+// must be released before the device is reset - the managed pool restores
+// the index buffer
+//
+void APIDynamicList::suspend() {
+
+    if (vb) {
+        vb->Release();
+        vb = nullptr;
+    }
+}
+
+// release releases the list's own buffer and the index buffer
+//
+void APIDynamicList::release() {
+
+    suspend();
+    capacity = 0;
+    if (ib) {
+        ib->Release();
+        ib = nullptr;
+    }
+    nIndices = 0;
+}
+
+// destructor releases the list's buffers
+//
+APIDynamicList::~APIDynamicList() {
+
+    release();
+}
+
+// endFrame issues the event that marks the end of the frame's reads from
+// the ring and records the bytes streamed in the frame - if STREAM_FRAMES
+// frames are already unfinished, the next event covers this frame too
+//
+void APIDynamicList::endFrame() {
+
+    lastFrame = streamed;
+    streamed  = 0;
+    if (ring && fence[0] && written != retired) {
+        retire(false);
+        if (nFences < STREAM_FRAMES && (!nFences || 
+         fenceMark[(oldest + nFences - 1) % STREAM_FRAMES] != written)) {
+            unsigned i = (oldest + nFences) % STREAM_FRAMES;
+            if (SUCCEEDED(fence[i]->Issue(D3DISSUE_END))) {
+                fenceMark[i] = written;
+                nFences++;
+            }
+        }
+    }
+}
+
+// dealloc releases the ring and the events - a buffer in the default pool
+// must be released before the device is reset
+//
+void APIDynamicList::dealloc() {
+
+    if (ring) {
+        ring->Release();
+        ring = nullptr;
+    }
+    for (unsigned i = 0; i < STREAM_FRAMES; i++)
+        if (fence[i]) {
+            fence[i]->Release();
+            fence[i] = nullptr;
+        }
+    nFences = 0;
+}
+
+//-------------------------------- APIQuadList --------------------------------
+//
+// The APIQuadList class streams quads whose vertices change every frame
+//
+// CreateAPIQuadList creates the APIQuadList object on dynamic memory
+//
+iAPIGraphic* CreateAPIQuadList(unsigned s, unsigned f, iGraphic* v) {
+
+    return new APIQuadList(s, f, v);
+}
+
+// constructor initializes the instance variables - the buffers are created
+// by the first draw
+//
+APIQuadList::APIQuadList(unsigned s, unsigned f, iGraphic* v) : vb(nullptr),
+ capacity(0), ib(nullptr), vertexList(v), vertexSize(s), vertexFrmt(f) {}
+
+APIQuadList::APIQuadList(const APIQuadList& src) {
+
+    vb    = nullptr;
+    ib    = nullptr;
+    *this = src;
+}
+
+APIQuadList& APIQuadList::operator=(const APIQuadList& src) {
+
+    if (this != &src) {
+        vertexList = src.vertexList;
+        vertexSize = src.vertexSize;
+        vertexFrmt = src.vertexFrmt;
+        release();
+    }
+
+    return *this;
+}
+
+// setup creates a dynamic vertex buffer in the default pool that holds at
+// least n vertices, doubling the previous capacity so that a growing list
+// reallocates rarely, and the index buffer that every batch of quads shares
+//
+void APIQuadList::setup(unsigned n) {
+
+    if (vb) {
+        vb->Release();
+        vb = nullptr;
+    }
+    unsigned c = capacity ? capacity : 4 * 256;
+    while (c < n) c *= 2;
+    if (FAILED(d3dd->CreateVertexBuffer(vertexSize * c, D3DUSAGE_DYNAMIC |
+     D3DUSAGE_WRITEONLY, vertexFrmt, D3DPOOL_DEFAULT, &vb, nullptr))) {
+        error(L"APIQuadList::10 Couldn\'t create the vertex buffer");
+        vb       = nullptr;
+        capacity = 0;
+    }
+    else
+        capacity = c;
+
+    if (vb && !ib) {
+        unsigned size = 6 * QUAD_BATCH * sizeof(unsigned short);
+        void*    pi;
+        if (FAILED(d3dd->CreateIndexBuffer(size, D3DUSAGE_WRITEONLY, 
+         D3DFMT_INDEX16, D3DPOOL_MANAGED, &ib, nullptr))) {
+            error(L"APIQuadList::11 Couldn\'t create the index buffer");
+            ib = nullptr;
+        }
+        else if (SUCCEEDED(ib->Lock(0, size, &pi, 0))) {
+            unsigned short* s = (unsigned short*)pi;
+            for (unsigned q = 0; q < QUAD_BATCH; q++, s += 6) {
+                unsigned short v = (unsigned short)(4 * q);
+                s[0] = v;
+                s[1] = v + 1;
+                s[2] = v + 2;
+                s[3] = v;
+                s[4] = v + 2;
+                s[5] = v + 3;
+            }
+            ib->Unlock();
+        }
+    }
+}
+
+// prepare creates the buffers for n vertices ahead of the first draw -
+// returns true if it created them
+//
+bool APIQuadList::prepare(unsigned n) {
+
+    if (vb || !n) return false;
+    setup(n);
+
+    return vb != nullptr;
+}
+
+// draw discards the contents of the vertex buffer, has the vertex list 
+// write n vertices into the fresh buffer and draws them as n / 4 quads in
+// batches of QUAD_BATCH - the texture's alpha is modulated by the vertex
+// alpha so that the quads can fade
+//
+void APIQuadList::draw(unsigned n) {
+
+    n -= n % 4;
+    if (!n) return;
+    if (!vb || n > capacity) setup(n);
+
+    void* pv;
+    if (vb && ib && SUCCEEDED(vb->Lock(0, vertexSize * n, &pv, 
+     D3DLOCK_DISCARD))) {
+        vertexList->upload(pv, n);
+        vb->Unlock();
+        d3dd->SetFVF(vertexFrmt);
+        d3dd->SetStreamSource(0, vb, 0, vertexSize);
+        d3dd->SetIndices(ib);
+        d3dd->SetTextureStageState(0, D3DTSS_ALPHAOP, D3DTOP_MODULATE);
+        for (unsigned first = 0; first < n; first += 4 * QUAD_BATCH) {
+            unsigned q = (n - first) / 4;
+            if (q > QUAD_BATCH) q = QUAD_BATCH;
+            d3dd->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, first, 0, 4 * q, 
+             0, 2 * q);
+        }
+        d3dd->SetTextureStageState(0, D3DTSS_ALPHAOP, D3DTOP_SELECTARG1);
+    }
+}
+
+// draw draws the quads once - their vertices are already in world space
+//
+void APIQuadList::draw(unsigned n, const void*, unsigned) {
+
+    draw(n);
+}
+
+// suspend releases the vertex buffer - a buffer in the default pool must
+// be released before the device is reset
+//
+void APIQuadList::suspend() {
+
+    if (vb) {
+        vb->Release();
+        vb = nullptr;
+    }
+}
+
+// release releases the interfaces to the vertex and index buffers
+//
+void APIQuadList::release() {
+
+    suspend();
+    capacity = 0;
+    if (ib) {
+        ib->Release();
+        ib = nullptr;
+    }
+}
+
+// destructor releases the buffers
+//
+APIQuadList::~APIQuadList() {
+
+    release();
+}
@@ -1,48 +1,162 @@
-#ifndef _API_GRAPHIC_H_
-#define _API_GRAPHIC_H_
-
-/* APIGraphic Definition - Translation Layer
- *
- * APIGraphic.h
- * fwk4gps version 3.0
- * gam666/dps901/gam670/dps905
- * January 14 2012
- * copyright (c) 2012 Chris Szalwinski 
- * distributed under TPL - see ../Licenses.txt
- */
-
-#include "APIPlatformSettings.h" // for API headers
-#include "APIBase.h"             // for the APIBase class definition
-#include "iAPIGraphic.h"         // for the APIGraphic Interface
-
-//-------------------------------- APIGraphic ---------------------------------
-//
-// The APIVertexList class implements the vertex list at the API level
-//
-struct IDirect3DVertexBuffer9;
-
-class APIVertexList : public iAPIGraphic, public APIBase {
-
-    unsigned                 nPrimitives; // number of primitives
-    D3DPRIMITIVETYPE         type;        // primitive type
-    IDirect3DVertexBuffer9*  vb;          // points to the vertex buffer
-    iGraphic*                vertexList;  // points to model vertex list
-    unsigned                 vertexSize;  // size of a single vertex
-    unsigned                 vertexFrmt;  // format of a vertex
-    unsigned                 nVertices;   // number of vertices
-
-    virtual ~APIVertexList();
-    void setup(unsigned);
-
-public:
-    APIVertexList(PrimitiveType t, unsigned np, unsigned, unsigned, iGraphic*);
-    APIVertexList& operator=(const APIVertexList&);
-    APIVertexList(const APIVertexList& src); 
-    iAPIGraphic* clone() const { return new APIVertexList(*this); }
-    void draw(unsigned);
-    void suspend();
-    void release();
-    void Delete() const        { delete this; }
-};
-
-#endif
+#ifndef _API_GRAPHIC_H_
+#define _API_GRAPHIC_H_
+
+/* APIGraphic Definition - Translation Layer
+ *
+ * APIGraphic.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "APIPlatformSettings.h" // for API headers
+#include "APIBase.h"             // for the APIBase class definition
+#include "iAPIGraphic.h"         // for the APIGraphic Interface
+
+//-------------------------------- APIGraphic ---------------------------------
+//
+// The APIVertexList class implements the vertex list at the API level
+//
+struct IDirect3DVertexBuffer9;
+struct IDirect3DIndexBuffer9;
+
+class APIVertexList : public iAPIGraphic, public APIBase {
+
+    unsigned                 nPrimitives; // number of primitives
+    D3DPRIMITIVETYPE         type;        // primitive type
+    IDirect3DVertexBuffer9*  vb;          // points to the vertex buffer
+    iGraphic*                vertexList;  // points to model vertex list
+    unsigned                 vertexSize;  // size of a single vertex
+    unsigned                 vertexFrmt;  // format of a vertex
+    unsigned                 nVertices;   // number of vertices
+    IDirect3DIndexBuffer9*   ib;          // points to the index buffer
+    unsigned                 nIndices;    // number of indices - 0 if none
+
+    virtual ~APIVertexList();
+    void setup(unsigned);
+
+public:
+    APIVertexList(PrimitiveType t, unsigned np, unsigned, unsigned, iGraphic*);
+    APIVertexList& operator=(const APIVertexList&);
+    APIVertexList(const APIVertexList& src); 
+    iAPIGraphic* clone() const { return new APIVertexList(*this); }
+    void attach(iGraphic* v)   { vertexList = v; }
+    bool prepare(unsigned);
+    void draw(unsigned);
+    void draw(unsigned, const void*, unsigned);
+    void suspend();
+    void release();
+    void Delete() const        { delete this; }
+};
+
+//-------------------------------- APIDynamicList -----------------------------
+//
+// The APIDynamicList class draws a vertex list whose vertices change every
+// frame - each draw reserves space in a ring buffer shared by all dynamic
+// lists, has the vertex list write its vertices straight into that space
+// and draws them from there
+//
+// the ring is appended to without overwriting until it is full - an event
+// query issued at the end of each frame marks the point up to which the 
+// device has finished reading, and a reservation that would overrun an 
+// unfinished frame waits for it or discards the whole ring if the current
+// frame alone fills it
+//
+// a list too large for the ring streams through a dynamic buffer of its
+// own, which is discarded on every draw - the indices of an indexed list
+// do not change, so they are held in a static index buffer and address 
+// the vertices relative to the first one streamed
+//
+struct IDirect3DQuery9;
+
+class APIDynamicList : public iAPIGraphic, public APIBase {
+
+    D3DPRIMITIVETYPE         type;        // primitive type
+    iGraphic*                vertexList;  // points to model vertex list
+    unsigned                 vertexSize;  // size of a single vertex
+    unsigned                 vertexFrmt;  // format of a vertex
+    IDirect3DVertexBuffer9*  vb;          // own buffer - oversized lists
+    unsigned                 capacity;    // vertices that vb can hold
+    IDirect3DIndexBuffer9*   ib;          // indices of an indexed list
+    unsigned                 nIndices;    // number of indices - 0 if none
+    bool                     reported;    // error reported already?
+
+    static IDirect3DVertexBuffer9* ring;  // shared dynamic vertex buffer
+    static IDirect3DQuery9*  fence[STREAM_FRAMES]; // end of frame events
+    static unsigned          fenceMark[STREAM_FRAMES]; // written at each
+    static unsigned          nFences;     // fences not yet passed
+    static unsigned          oldest;      // index of the oldest fence
+    static unsigned          head;        // offset of the next write
+    static unsigned          written;     // bytes written since setup
+    static unsigned          retired;     // bytes the device has read
+    static unsigned          streamed;    // bytes streamed in this frame
+    static unsigned          lastFrame;   // bytes streamed in last frame
+    static unsigned          stalls;      // waits for the device
+
+    virtual ~APIDynamicList();
+    unsigned primitives(unsigned n) const;
+    void*    reserve(unsigned n, unsigned& first);
+    void*    lock(unsigned n, unsigned& first, IDirect3DVertexBuffer9*& b);
+    bool     setup();
+    void     setup(unsigned n);
+    bool     setupIndices(unsigned n);
+    void     render(unsigned first, unsigned n) const;
+    static void retire(bool wait);
+
+public:
+    APIDynamicList(PrimitiveType t, unsigned, unsigned, iGraphic*);
+    APIDynamicList& operator=(const APIDynamicList&);
+    APIDynamicList(const APIDynamicList& src);
+    iAPIGraphic* clone() const { return new APIDynamicList(*this); }
+    void attach(iGraphic* v)   { vertexList = v; }
+    bool prepare(unsigned);
+    void draw(unsigned);
+    void draw(unsigned, const void*, unsigned);
+    void suspend();
+    void release();
+    void Delete() const        { delete this; }
+    // device state
+    static void     endFrame();
+    static void     dealloc();
+    static unsigned noStreamedBytes() { return lastFrame; }
+    static unsigned noStalls()        { return stalls; }
+};
+
+//-------------------------------- APIQuadList --------------------------------
+//
+// The APIQuadList class streams a list of quads that is rebuilt every frame
+// - each quad is four vertices drawn as two triangles through a shared 
+// index buffer
+//
+// quads drawn by a single call - 16-bit indices address all of their vertices
+#define QUAD_BATCH 16384
+
+class APIQuadList : public iAPIGraphic, public APIBase {
+
+    IDirect3DVertexBuffer9*  vb;          // dynamic vertex buffer
+    unsigned                 capacity;    // vertices that vb can hold
+    IDirect3DIndexBuffer9*   ib;          // indices of QUAD_BATCH quads
+    iGraphic*                vertexList;  // points to model vertex list
+    unsigned                 vertexSize;  // size of a single vertex
+    unsigned                 vertexFrmt;  // format of a vertex
+
+    virtual ~APIQuadList();
+    void setup(unsigned);
+
+public:
+    APIQuadList(unsigned, unsigned, iGraphic*);
+    APIQuadList& operator=(const APIQuadList&);
+    APIQuadList(const APIQuadList& src); 
+    iAPIGraphic* clone() const { return new APIQuadList(*this); }
+    void attach(iGraphic* v)   { vertexList = v; }
+    bool prepare(unsigned);
+    void draw(unsigned);
+    void draw(unsigned, const void*, unsigned);
+    void suspend();
+    void release();
+    void Delete() const        { delete this; }
+};
+
+#endif
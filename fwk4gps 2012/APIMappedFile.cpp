@@ -0,0 +1,66 @@
+/* APIMappedFile Implementation - Translation Layer
+ *
+ * APIMappedFile.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>         // for CreateFile, MapViewOfFile
+#include "APIMappedFile.h"   // for the APIMappedFile class definition
+
+//-------------------------------- APIMappedFile ------------------------------
+//
+// The APIMappedFile class maps a file read-only into memory
+//
+// CreateAPIMappedFile maps file f into memory - returns nullptr if the file
+// cannot be opened or mapped
+//
+iAPIMappedFile* CreateAPIMappedFile(const wchar_t* f) {
+
+    APIMappedFile* m = new APIMappedFile(f);
+    if (!m->data()) {
+        m->Delete();
+        m = nullptr;
+    }
+
+    return m;
+}
+
+// constructor opens file f and maps its contents
+//
+APIMappedFile::APIMappedFile(const wchar_t* f) : file(nullptr), 
+ mapping(nullptr), view(nullptr), bytes(0) {
+
+    HANDLE h = CreateFile(f, GENERIC_READ, FILE_SHARE_READ, nullptr,
+     OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (h == INVALID_HANDLE_VALUE)
+        return;
+    file = h;
+
+    LARGE_INTEGER s;
+    if (!GetFileSizeEx(h, &s) || s.HighPart || !s.LowPart)
+        return;
+    bytes = s.LowPart;
+
+    mapping = CreateFileMapping(h, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping)
+        view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view)
+        bytes = 0;
+}
+
+// destructor unmaps the contents and closes the file
+//
+APIMappedFile::~APIMappedFile() {
+
+    if (view)
+        UnmapViewOfFile(view);
+    if (mapping)
+        CloseHandle(mapping);
+    if (file)
+        CloseHandle(file);
+}
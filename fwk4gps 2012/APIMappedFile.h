@@ -0,0 +1,40 @@
+#ifndef _API_MAPPED_FILE_H_
+#define _API_MAPPED_FILE_H_
+
+/* APIMappedFile Definition - Translation Layer
+ *
+ * APIMappedFile.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "APIBase.h"        // for the APIBase class definition
+#include "iAPIMappedFile.h" // for the APIMappedFile Interface
+
+//-------------------------------- APIMappedFile ------------------------------
+//
+// The APIMappedFile class maps a file read-only into the address space of
+// the application
+//
+class APIMappedFile : public iAPIMappedFile, public APIBase {
+
+    void*       file;    // handle to the open file
+    void*       mapping; // handle to the file mapping
+    const void* view;    // address of the mapped contents
+    unsigned    bytes;   // size of the file in bytes
+
+    APIMappedFile(const APIMappedFile&);
+    APIMappedFile& operator=(const APIMappedFile&);
+    virtual ~APIMappedFile();
+
+  public:
+    APIMappedFile(const wchar_t*);
+    const void* data() const   { return view; }
+    unsigned    size() const   { return bytes; }
+    void        Delete() const { delete this; }
+};
+
+#endif
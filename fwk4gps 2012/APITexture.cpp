@@ -1,164 +1,375 @@
-/* APITexture Implementation - Translation Layer
- *
- * APITexture.cpp
- * fwk4gps version 3.0
- * gam666/dps901/gam670/dps905
- * January 14 2012
- * copyright (c) 2012 Chris Szalwinski 
- * distributed under TPL - see ../Licenses.txt
- */
-
-#include "APIPlatformSettings.h" // for API headers
-#include "APITexture.h"          // for the APITexture class definition
-#include "iUtilities.h"          // for strlen()
-#include "Common_Symbols.h"      // symbols common to Modelling/Translation
-
-//-------------------------------- APITexture ---------------------------------
-//
-// The APITexture class implements a texture at the API level
-//
-iAPITexture* CreateAPITexture(const wchar_t* file, unsigned filter) {
-
-	return new APITexture(file, filter);
-}
-
-// constructor initializes the texture identifier
-//
-APITexture::APITexture(const wchar_t* file, unsigned f) : filter(f) {
-
-	if (file) {
-        int len = strlen(file);
-	    this->file = new wchar_t[len + 1];
-	    strcpy(this->file, file, len);
-    }
-    else
-        this->file = nullptr;
-
-    tex = nullptr;
-}
-
-APITexture::APITexture(const APITexture& src) {
-
-    file  = nullptr;
-    tex   = nullptr;
-    *this = src;    
-}
-
-iAPITexture& APITexture::operator=(const APITexture& src) {
-
-    if (this != &src) {
-        if (file)
-            delete [] file;
-        if (src.file) {
-            int len = strlen(src.file);
-            file = new wchar_t[len + 1];
-            strcpy(file, src.file, len);
-        }
-        else
-            file = nullptr;
-        suspend();
-        filter = src.filter;
-        tex = nullptr;
-    }
-
-    return *this;
-}
-
-// setup creates the api texture from the texture file
-//
-void APITexture::setup(int width, int height, int key) {
-
-    // create a texture COM object from the texture file
-    //
-	if (manager && file && FAILED(D3DXCreateTextureFromFileEx(d3dd, file, 
-     width, height, D3DX_DEFAULT, 0, D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, 
-     D3DX_DEFAULT, D3DX_DEFAULT, key, nullptr, nullptr, &tex))) {
-		error(L"APITexture::11 Failed to create texture COM object from file");
-		tex = nullptr;
-	}
-}
-
-// render draws the texture directly
-//
-void APITexture::render(const Rectf& r, unsigned char alpha, bool back) {
-
-	if (!tex) setup((int)(width * (r.bottomRightX - r.topLeftX)), 
-	 (int)(height * (r.bottomRightY - r.topLeftY)), 0xFF000000);
-
-	if (manager && tex) {
-        float x = width * r.topLeftX, y = height * r.topLeftY;
-		D3DXVECTOR3 topLeft(x, y, back ? 1.f : 0.f);
-		manager->Draw(tex, nullptr, nullptr, &topLeft, 
-         D3DCOLOR_RGBA(255, 255, 255, back ? '\xFF' : alpha));
-	}
-}
-
-// attach attaches the api texture to sampling stage i
-//
-void APITexture::setFilter(unsigned filter) {
-
-    if (tex)
-		setSamplerState(0, filter);
-}
-
-// attach attaches the api texture to sampling stage i
-//
-void APITexture::attach() {
-
-	if (!tex) setup(0, 0, 0);
-
-    if (tex) {
-        d3dd->SetTexture(0, tex);
-		setSamplerState(0, filter);
-    }
-}
-
-// setSamplerState sets the sampling state for the texture according 
-// to the filtering flags
-//
-void APITexture::setSamplerState(int i, unsigned flags) const {
-
-    if (flags & TEX_MIN_POINT)
-        d3dd->SetSamplerState(i, D3DSAMP_MINFILTER, D3DTEXF_POINT);
-    else if (flags & TEX_MIN_LINEAR)
-        d3dd->SetSamplerState(i, D3DSAMP_MINFILTER, D3DTEXF_LINEAR);
-    else if (flags & TEX_MIN_ANISOTROPIC)
-        d3dd->SetSamplerState(i, D3DSAMP_MINFILTER, D3DTEXF_ANISOTROPIC); 
-    if (flags & TEX_MAG_POINT)
-        d3dd->SetSamplerState(i, D3DSAMP_MAGFILTER, D3DTEXF_POINT);
-    else if (flags & TEX_MAG_LINEAR)
-        d3dd->SetSamplerState(i, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR);
-}
-
-// detach detaches the api texture from sampling stage 0
-//
-void APITexture::detach() {
-
-    if (tex)
-        d3dd->SetTexture(0, nullptr);
-}
-
-// suspend releases the api texture
-//
-void APITexture::suspend() {
-
-    // release the Interface to the texture COM object
-    if (tex) {
-        tex->Release();
-        tex = nullptr;
-    }
-}
-
-// releases suspends the api texture
-//
-void APITexture::release() {
-
-    suspend();
-}
-
-// destructor releases the api texture 
-//
-APITexture::~APITexture() {
-
-   release();
-}
+/* APITexture Implementation - Translation Layer
+ *
+ * APITexture.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <cstring>               // for memcpy
+#include "APIPlatformSettings.h" // for API headers, PLACEHOLDER_R, ...
+#include "APITexture.h"          // for the APITexture class definition
+#include "iUtilities.h"          // for strlen()
+#include "Common_Symbols.h"      // symbols common to Modelling/Translation
+
+//-------------------------------- APITexture ---------------------------------
+//
+// The APITexture class implements a texture at the API level
+//
+// shadow copy of the sampling stage 0 state
+//
+IDirect3DTexture9* APITexture::bound      = nullptr;
+bool               APITexture::boundKnown = false;
+unsigned           APITexture::minFilter  = 0;
+unsigned           APITexture::magFilter  = 0;
+unsigned           APITexture::filtered   = 0;
+IDirect3DTexture9* APITexture::pending    = nullptr;
+
+iAPITexture* CreateAPITexture(const wchar_t* file, unsigned filter) {
+
+	return new APITexture(file, filter);
+}
+
+// constructor initializes the texture identifier
+//
+APITexture::APITexture(const wchar_t* file, unsigned f) : filter(f),
+ image(nullptr), size(0), deferred(false), pixels(nullptr), stagedWidth(0),
+ stagedHeight(0) {
+
+	if (file) {
+        int len = strlen(file);
+	    this->file = new wchar_t[len + 1];
+	    strcpy(this->file, file, len);
+    }
+    else
+        this->file = nullptr;
+
+    tex = nullptr;
+}
+
+APITexture::APITexture(const APITexture& src) {
+
+    file     = nullptr;
+    tex      = nullptr;
+    image    = nullptr;
+    size     = 0;
+    deferred = false;
+    pixels   = nullptr;
+    *this    = src;    
+}
+
+iAPITexture& APITexture::operator=(const APITexture& src) {
+
+    if (this != &src) {
+        if (file)
+            delete [] file;
+        if (src.file) {
+            int len = strlen(src.file);
+            file = new wchar_t[len + 1];
+            strcpy(file, src.file, len);
+        }
+        else
+            file = nullptr;
+        discard();
+        filter = src.filter;
+        // a copy rebuilds its texture from the file rather than the staging
+        // copy of src
+        if (pixels)
+            delete [] pixels;
+        pixels = nullptr;
+        // a copy reads the file itself rather than wait for src's contents
+        if (image)
+            delete [] image;
+        if (src.image) {
+            image = new unsigned char[src.size];
+            memcpy(image, src.image, src.size);
+            size = src.size;
+        }
+        else {
+            image = nullptr;
+            size  = 0;
+        }
+        deferred = false;
+    }
+
+    return *this;
+}
+
+// load takes ownership of the contents of the texture file read on a
+// worker thread - null contents revert to reading the file in setup
+//
+void APITexture::load(unsigned char* data, unsigned n) {
+
+    if (image)
+        delete [] image;
+    image    = data;
+    size     = data ? n : 0;
+    deferred = false;
+}
+
+// setup creates the api texture from the contents of the texture file if
+// they have been read and otherwise from the texture file - the contents
+// are discarded once used so that later setups read the file
+//
+void APITexture::setup(int width, int height, int key) {
+
+    if (!manager || deferred)
+        ; // no device or the contents have not arrived
+    else if (pixels)
+        restage();
+    else if (image) {
+        // create a texture COM object from the contents in memory
+        //
+	    if (FAILED(D3DXCreateTextureFromFileInMemoryEx(d3dd, image, size, 
+         width, height, D3DX_DEFAULT, 0, D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, 
+         D3DX_DEFAULT, D3DX_DEFAULT, key, nullptr, nullptr, &tex))) {
+		    error(L"APITexture::12 Failed to create texture COM object from "
+             L"memory");
+		    tex = nullptr;
+	    }
+        delete [] image;
+        image = nullptr;
+        size  = 0;
+    }
+    // create a texture COM object from the texture file
+    //
+	else if (file && FAILED(D3DXCreateTextureFromFileEx(d3dd, file, 
+     width, height, D3DX_DEFAULT, 0, D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, 
+     D3DX_DEFAULT, D3DX_DEFAULT, key, nullptr, nullptr, &tex))) {
+		error(L"APITexture::11 Failed to create texture COM object from file");
+		tex = nullptr;
+	}
+}
+
+// prepare creates the api texture for attachment ahead of its first use -
+// returns true if it created the texture
+//
+bool APITexture::prepare() {
+
+    if (tex || deferred) return false;
+    setup(0, 0, 0);
+
+    return tex != nullptr;
+}
+
+// stage copies the top level of the texture into system memory before the
+// device is released so that the texture can be rebuilt without reading
+// or decoding its file
+//
+void APITexture::stage() {
+
+    D3DSURFACE_DESC d;
+    D3DLOCKED_RECT  r;
+
+    if (tex && !pixels && SUCCEEDED(tex->GetLevelDesc(0, &d)) && 
+     d.Format == D3DFMT_A8R8G8B8 && 
+     SUCCEEDED(tex->LockRect(0, &r, nullptr, D3DLOCK_READONLY))) {
+        stagedWidth  = d.Width;
+        stagedHeight = d.Height;
+        pixels       = new unsigned[stagedWidth * stagedHeight];
+        for (unsigned y = 0; y < stagedHeight; y++)
+            memcpy(pixels + y * stagedWidth, (char*)r.pBits + y * r.Pitch,
+             stagedWidth * sizeof(unsigned));
+        tex->UnlockRect(0);
+    }
+}
+
+// restage rebuilds the texture from its staging copy - copies the top level
+// and filters the lower levels from it - and discards the copy
+//
+void APITexture::restage() {
+
+    D3DLOCKED_RECT r;
+
+    if (FAILED(d3dd->CreateTexture(stagedWidth, stagedHeight, 0, 0, 
+     D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, &tex, nullptr))) {
+        error(L"APITexture::13 Failed to create texture COM object from "
+         L"staging copy");
+        tex = nullptr;
+    }
+    else if (SUCCEEDED(tex->LockRect(0, &r, nullptr, 0))) {
+        for (unsigned y = 0; y < stagedHeight; y++)
+            memcpy((char*)r.pBits + y * r.Pitch, pixels + y * stagedWidth,
+             stagedWidth * sizeof(unsigned));
+        tex->UnlockRect(0);
+        D3DXFilterTexture(tex, nullptr, 0, D3DX_DEFAULT);
+    }
+    delete [] pixels;
+    pixels = nullptr;
+}
+
+// render draws the texture directly
+//
+void APITexture::render(const Rectf& r, unsigned char alpha, bool back) {
+
+	if (!tex) setup((int)(width * (r.bottomRightX - r.topLeftX)), 
+	 (int)(height * (r.bottomRightY - r.topLeftY)), 0xFF000000);
+
+	if (manager && tex) {
+        float x = width * r.topLeftX, y = height * r.topLeftY;
+		D3DXVECTOR3 topLeft(x, y, back ? 1.f : 0.f);
+		manager->Draw(tex, nullptr, nullptr, &topLeft, 
+         D3DCOLOR_RGBA(255, 255, 255, back ? '\xFF' : alpha));
+	}
+}
+
+// attach attaches the api texture to sampling stage i
+//
+void APITexture::setFilter(unsigned filter) {
+
+    if (tex)
+		setSamplerState(0, filter);
+}
+
+// attach attaches the api texture to sampling stage i
+//
+void APITexture::attach() {
+
+	if (!tex) setup(0, 0, 0);
+
+    if (tex) {
+        bind(tex);
+		setSamplerState(0, filter);
+    }
+    else if (deferred) {
+        attachPending();
+		setSamplerState(0, filter);
+    }
+}
+
+// attachPending attaches the placeholder texture - a single texel of the
+// placeholder colour - to sampling stage 0, creating it if necessary
+//
+void APITexture::attachPending() {
+
+    if (!pending && d3dd && SUCCEEDED(d3dd->CreateTexture(1, 1, 1, 0, 
+     D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, &pending, nullptr))) {
+        D3DLOCKED_RECT r;
+        if (SUCCEEDED(pending->LockRect(0, &r, nullptr, 0))) {
+            *(D3DCOLOR*)r.pBits = D3DCOLOR_XRGB(PLACEHOLDER_R, PLACEHOLDER_G,
+             PLACEHOLDER_B);
+            pending->UnlockRect(0);
+        }
+    }
+    if (pending)
+        bind(pending);
+}
+
+// setSamplerState sets the sampling state for the texture according 
+// to the filtering flags
+//
+void APITexture::setSamplerState(int i, unsigned flags) const {
+
+    if (flags & TEX_MIN_POINT)
+        setSampler(i, D3DSAMP_MINFILTER, D3DTEXF_POINT);
+    else if (flags & TEX_MIN_LINEAR)
+        setSampler(i, D3DSAMP_MINFILTER, D3DTEXF_LINEAR);
+    else if (flags & TEX_MIN_ANISOTROPIC)
+        setSampler(i, D3DSAMP_MINFILTER, D3DTEXF_ANISOTROPIC); 
+    if (flags & TEX_MAG_POINT)
+        setSampler(i, D3DSAMP_MAGFILTER, D3DTEXF_POINT);
+    else if (flags & TEX_MAG_LINEAR)
+        setSampler(i, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR);
+}
+
+// setSampler sets filter type on stage i to value unless stage 0 already
+// holds that value
+//
+void APITexture::setSampler(int i, unsigned type, unsigned value) {
+
+    unsigned* last = i ? nullptr : type == D3DSAMP_MINFILTER ? &minFilter :
+     type == D3DSAMP_MAGFILTER ? &magFilter : nullptr;
+
+    if (last && *last == value)
+        filtered++;
+    else {
+        d3dd->SetSamplerState(i, (D3DSAMPLERSTATETYPE)type, value);
+        if (last) *last = value;
+    }
+}
+
+// bind attaches texture t to sampling stage 0 unless it is already attached
+//
+void APITexture::bind(IDirect3DTexture9* t) {
+
+    if (boundKnown && bound == t)
+        filtered++;
+    else {
+        d3dd->SetTexture(0, t);
+        bound      = t;
+        boundKnown = true;
+    }
+}
+
+// invalidate forgets the shadow copy of the sampling stage 0 state so that
+// the next call for each state reaches the device
+//
+void APITexture::invalidate() {
+
+    bound      = nullptr;
+    boundKnown = false;
+    minFilter  = 0;
+    magFilter  = 0;
+}
+
+// dealloc releases the placeholder texture before the device is released
+//
+void APITexture::dealloc() {
+
+    if (pending) {
+        if (pending == bound)
+            boundKnown = false;
+        pending->Release();
+        pending = nullptr;
+    }
+}
+
+// detach detaches the api texture from sampling stage 0
+//
+void APITexture::detach() {
+
+    if (tex || deferred)
+        bind(nullptr);
+}
+
+// suspend keeps the api texture - the managed pool restores it after a
+// device reset without reading its file again
+//
+void APITexture::suspend() {
+
+}
+
+// discard releases the Interface to the texture COM object - a new texture
+// may reuse its address
+//
+void APITexture::discard() {
+
+    if (tex) {
+        if (tex == bound)
+            boundKnown = false;
+        tex->Release();
+        tex = nullptr;
+    }
+}
+
+// release stages the contents of the api texture and releases it along
+// with the device
+//
+void APITexture::release() {
+
+    stage();
+    discard();
+}
+
+// destructor releases the api texture 
+//
+APITexture::~APITexture() {
+
+   discard();
+   if (image)
+       delete [] image;
+   if (pixels)
+       delete [] pixels;
+}
@@ -1,52 +1,85 @@
-#ifndef _API_TEXTURE_H_
-#define _API_TEXTURE_H_
-
-/* APITexture Definition - Translation Layer
- *
- * APITexture.h
- * fwk4gps version 3.0
- * gam666/dps901/gam670/dps905
- * January 14 2012
- * copyright (c) 2012 Chris Szalwinski 
- * distributed under TPL - see ../Licenses.txt
- */
-
-#include "iAPITexture.h" // for the APITexture Interface
-#include "APIBase.h"     // for the APIBase class definition
-
-//-------------------------------- APITexture ---------------------------------
-//
-// The APITexture class implements a Texture at the API level
-//
-struct IDirect3DTexture9;
-
-class APITexture : public iAPITexture, public APIBase {
-
-    wchar_t*           file;   // points to file with texture image
-    unsigned           filter; // default texture filtering flags
-
-    IDirect3DTexture9* tex;    // interface to texture COM object
-
-	virtual ~APITexture();
-
-	void setSamplerState(int i, unsigned flags) const;
-	void setup(int w, int h, int c);
-
-  public:
-    APITexture(const wchar_t* file, unsigned filter = 0);
-	APITexture(const APITexture&);
-	iAPITexture& operator=(const APITexture&);
-    iAPITexture* clone() const { return new APITexture(*this); }
-	// execution
-	void   attach();
-    void   setFilter(unsigned filter);
-	void   detach();
-	void   render(const Rectf&, unsigned char, bool);
-    // suspension
-    void   suspend();
-	// termination
-    void   release();
-	void   Delete() const { delete this; }
-};
-
+#ifndef _API_TEXTURE_H_
+#define _API_TEXTURE_H_
+
+/* APITexture Definition - Translation Layer
+ *
+ * APITexture.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "iAPITexture.h" // for the APITexture Interface
+#include "APIBase.h"     // for the APIBase class definition
+
+//-------------------------------- APITexture ---------------------------------
+//
+// The APITexture class implements a Texture at the API level
+//
+struct IDirect3DTexture9;
+
+class APITexture : public iAPITexture, public APIBase {
+
+    wchar_t*           file;     // points to file with texture image
+    unsigned           filter;   // default texture filtering flags
+    unsigned char*     image;    // contents of file read asynchronously
+    unsigned           size;     // size of the contents in bytes
+    bool               deferred; // contents are being read?
+    unsigned*          pixels;   // staging copy of the top level while
+                                 // the device is released - A8R8G8B8
+    unsigned           stagedWidth;  // width of the staging copy
+    unsigned           stagedHeight; // height of the staging copy
+
+    IDirect3DTexture9* tex;      // interface to texture COM object
+
+    // placeholder attached in place of deferred textures
+    static IDirect3DTexture9* pending;
+
+    // shadow copy of the sampling stage 0 state
+    static IDirect3DTexture9* bound;      // texture attached to stage 0
+    static bool               boundKnown; // attached texture is known?
+    static unsigned           minFilter;  // last minification filter - 0
+    static unsigned           magFilter;  // last magnification filter - 0
+                                          // if not known
+    static unsigned           filtered;   // number of filtered calls
+
+	virtual ~APITexture();
+
+    static void bind(IDirect3DTexture9* t);
+    static void setSampler(int i, unsigned type, unsigned value);
+    static void attachPending();
+
+	void setSamplerState(int i, unsigned flags) const;
+	void setup(int w, int h, int c);
+	void stage();
+	void restage();
+	void discard();
+
+  public:
+    APITexture(const wchar_t* file, unsigned filter = 0);
+	APITexture(const APITexture&);
+	iAPITexture& operator=(const APITexture&);
+    iAPITexture* clone() const { return new APITexture(*this); }
+	// initialization
+	void   defer()             { deferred = true; }
+	void   load(unsigned char* data, unsigned size);
+	bool   prepare();
+	// execution
+	void   attach();
+    void   setFilter(unsigned filter);
+	void   detach();
+	void   render(const Rectf&, unsigned char, bool);
+    // suspension
+    void   suspend();
+	// termination
+    void   release();
+	void   Delete() const { delete this; }
+    // device state
+    static void     invalidate();
+    static void     dealloc();
+    static unsigned noFilteredCalls() { return filtered; }
+};
+
 #endif
\ No newline at end of file
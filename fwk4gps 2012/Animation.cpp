@@ -0,0 +1,462 @@
+/* Animation Implementation - Modelling Layer
+ *
+ * Animation.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <algorithm>         // for sort, upper_bound
+#include <utility>           // for pair
+#include "Animation.h"       // for the Animation class definition
+#include "iCoordinator.h"    // for the Coordinator Interface
+#include "iFrame.h"          // for the Frame Interface
+#include "MathDefinitions.h" // for math functions in model coordinates
+#include "ModellingLayer.h"  // for ANIMATION_MAX_STEP
+#include "QuaternionBatch.h"  // for the batched quaternion functions
+
+//-------------------------------- Animation ----------------------------------
+//
+// The Animation object poses a frame from a clip of keyframed tracks
+//
+// identity values of the tracks - an empty track leaves its part of the
+// frame's transformation as it was when bound
+static const float identity[ANIMATION_TRACKS][4] = {
+    {0, 0, 0, 0}, {0, 0, 0, 1}, {1, 1, 1, 0}
+};
+
+// CreateAnimation creates an Animation object with an empty clip
+//
+iAnimation* CreateAnimation() {
+
+    return new Animation();
+}
+
+// Clone creates a copy of *src that shares its clip and is unbound
+//
+iAnimation* Clone(const iAnimation* src) {
+
+    return (iAnimation*)src->clone();
+}
+
+// constructor creates the empty clip and adds the animation to the
+// coordinator
+//
+Animation::Animation() : frame(nullptr), base(1), time(0), speed(1),
+ playing(false), loop(true), lastStep(now) {
+
+    coordinator->add(this);
+
+    clip         = new Clip;
+    clip->refs   = 1;
+    clip->length = 0;
+    for (unsigned k = 0; k < ANIMATION_TRACKS; k++) {
+        clip->track[k].mode  = INTERPOLATE_LINEAR;
+        clip->track[k].width = k == 1 ? 4 : 3;
+        cursor[k]            = 0;
+    }
+}
+
+// copy constructor shares the clip of src - the copy is not bound to a
+// frame
+//
+Animation::Animation(const Animation& src) : clip(src.clip),
+ frame(nullptr), base(1), time(src.time), speed(src.speed),
+ playing(src.playing), loop(src.loop), lastStep(now) {
+
+    coordinator->add(this);
+
+    clip->refs++;
+    for (unsigned k = 0; k < ANIMATION_TRACKS; k++)
+        cursor[k] = 0;
+}
+
+// unshare gives the animation its own copy of the clip before the clip is
+// changed - the other animations keep the original clip
+//
+void Animation::unshare() {
+
+    if (clip->refs > 1) {
+        Clip* c = new Clip(*clip);
+        c->refs = 1;
+        clip->refs--;
+        clip    = c;
+    }
+}
+
+// addKey inserts the key with values v at time t into track k, after any
+// key at the same time - rotation keys are normalized and their signs are
+// chosen so that each key lies on the shorter arc from the one before it
+//
+void Animation::addKey(unsigned k, float t, const float* v) {
+
+    unshare();
+    AnimationTrack& track = clip->track[k];
+    unsigned w = track.width;
+    unsigned i = std::upper_bound(track.time.begin(), track.time.end(), t) -
+     track.time.begin();
+    track.time.insert(track.time.begin() + i, t);
+    track.value.insert(track.value.begin() + i * w, v, v + w);
+
+    if (w == 4) {
+        float* q = &track.value[0];
+        unsigned n = track.time.size();
+        for (unsigned j = 0; j < n; j++) {
+            Quaternion r = normal(Quaternion(q[4 * j], q[4 * j + 1],
+             q[4 * j + 2], q[4 * j + 3]));
+            if (j && dot(r, Quaternion(q[4 * j - 4], q[4 * j - 3],
+             q[4 * j - 2], q[4 * j - 1])) < 0)
+                r = Quaternion(-r.x, -r.y, -r.z, -r.w);
+            q[4 * j]     = r.x;
+            q[4 * j + 1] = r.y;
+            q[4 * j + 2] = r.z;
+            q[4 * j + 3] = r.w;
+        }
+    }
+    if (t > clip->length) clip->length = t;
+    for (unsigned j = 0; j < ANIMATION_TRACKS; j++)
+        cursor[j] = 0;
+}
+
+// addTranslation adds a key that translates the frame by v at time t - z
+// is in model coordinates as for Frame::translate
+//
+void Animation::addTranslation(float t, const Vector& v) {
+
+    float f[3] = {v.x, v.y, v.z};
+    addKey(0, t, f);
+}
+
+// addRotation adds a key that rotates the frame by q at time t - q is in
+// the form returned by quaternion(axis, rad)
+//
+void Animation::addRotation(float t, const Quaternion& q) {
+
+    float f[4] = {q.x, q.y, q.z, q.w};
+    addKey(1, t, f);
+}
+
+// addScale adds a key that scales the frame by s at time t
+//
+void Animation::addScale(float t, const Vector& s) {
+
+    float f[3] = {s.x, s.y, s.z};
+    addKey(2, t, f);
+}
+
+// setInterpolation sets the interpolation of each track - slerp and nlerp
+// are linear on translation and scale and linear is nlerp on rotation
+//
+void Animation::setInterpolation(Interpolation t, Interpolation r,
+ Interpolation s) {
+
+    unshare();
+    clip->track[0].mode = t;
+    clip->track[1].mode = r;
+    clip->track[2].mode = s;
+}
+
+// bind binds the animation to frame f and records the frame's current
+// transformation as the base that the clip poses relative to - nullptr
+// unbinds the animation
+//
+void Animation::bind(iFrame* f) {
+
+    frame = f;
+    if (frame) base = frame->local();
+}
+
+// play starts the clip from its current time - a clip that does not loop
+// stops at its end
+//
+void Animation::play(bool l) {
+
+    loop     = l;
+    playing  = true;
+    lastStep = now;
+}
+
+// setTime moves the clip to time t in seconds
+//
+void Animation::setTime(float t) {
+
+    time = t < 0 ? 0 : t > clip->length ? clip->length : t;
+}
+
+// step advances the clip by the time since the last update - a looping
+// clip wraps at either end and any other clip stops there
+//
+void Animation::step() {
+
+    float s  = (float)(now - lastStep) / unitsPerSec;
+    lastStep = now;
+    time    += speed * (s > ANIMATION_MAX_STEP ? ANIMATION_MAX_STEP : s);
+
+    float length = clip->length;
+    if (time >= length || time < 0) {
+        if (loop && length > 0) {
+            time = fmodf(time, length);
+            if (time < 0) time += length;
+        }
+        else {
+            time    = time < 0 ? 0 : length;
+            playing = false;
+        }
+    }
+}
+
+// locate finds the key i of track k at or before the current time and the
+// fraction u of the way from key i to key i + 1 - returns false if the
+// track is empty or the time lies outside its keys, in which case i is the
+// key to hold - the search starts from the key last located, so that a
+// clip playing forward finds its key in a step or two
+//
+bool Animation::locate(unsigned k, unsigned& i, float& u) {
+
+    const AnimationTrack& track = clip->track[k];
+    unsigned n = track.time.size();
+
+    if (!n) return false;
+
+    const float* kt = &track.time[0];
+    if (n == 1 || time <= kt[0] || time >= kt[n - 1]) {
+        i = time >= kt[n - 1] ? n - 1 : 0;
+        return false;
+    }
+
+    i = cursor[k];
+    if (i >= n - 1 || kt[i] > time) i = 0;
+    while (kt[i + 1] <= time) i++;
+    cursor[k] = i;
+    u = (time - kt[i]) / (kt[i + 1] - kt[i]);
+
+    return true;
+}
+
+// sample stores in v the value of track k at the current time
+//
+void Animation::sample(unsigned k, float* v) {
+
+    const AnimationTrack& track = clip->track[k];
+    unsigned w = track.width, n = track.time.size(), i;
+    float u;
+
+    if (!n) {
+        for (unsigned c = 0; c < w; c++)
+            v[c] = identity[k][c];
+        return;
+    }
+
+    const float* kt  = &track.time[0];
+    const float* key = &track.value[0];
+    if (!locate(k, i, u)) {
+        for (unsigned c = 0; c < w; c++)
+            v[c] = key[i * w + c];
+        return;
+    }
+
+    float h = kt[i + 1] - kt[i];
+    const float* a = key + i * w;
+    const float* b = a + w;
+
+    if (track.mode == INTERPOLATE_CUBIC && w == 4) {
+        // squad through the keys - the neighbours set the control rotations
+        Quaternion qp = i ? Quaternion(a[-4], a[-3], a[-2], a[-1]) :
+         Quaternion(a[0], a[1], a[2], a[3]);
+        Quaternion qa(a[0], a[1], a[2], a[3]), qb(b[0], b[1], b[2], b[3]);
+        Quaternion qn = i + 2 < n ? Quaternion(b[4], b[5], b[6], b[7]) : qb;
+        Quaternion r  = squad(qa, qb, squadControl(qp, qa, qb),
+         squadControl(qa, qb, qn), u);
+        v[0] = r.x;
+        v[1] = r.y;
+        v[2] = r.z;
+        v[3] = r.w;
+        return;
+    }
+    else if (track.mode == INTERPOLATE_CUBIC) {
+        // Hermite segment with Catmull-Rom tangents - one-sided at the ends
+        const float* p = i ? a - w : a;
+        const float* q = i + 2 < n ? b + w : b;
+        float ma  = h / (kt[i + 1] - (i ? kt[i - 1] : kt[i]));
+        float mb  = h / ((i + 2 < n ? kt[i + 2] : kt[i + 1]) - kt[i]);
+        float u2  = u * u, u3 = u2 * u;
+        float h00 = 2 * u3 - 3 * u2 + 1, h10 = u3 - 2 * u2 + u;
+        float h01 = 3 * u2 - 2 * u3,     h11 = u3 - u2;
+        for (unsigned c = 0; c < w; c++)
+            v[c] = h00 * a[c] + h10 * ma * (b[c] - p[c]) + h01 * b[c] +
+             h11 * mb * (q[c] - a[c]);
+    }
+    else if (track.mode == INTERPOLATE_SLERP && w == 4) {
+        Quaternion r = slerp(Quaternion(a[0], a[1], a[2], a[3]),
+         Quaternion(b[0], b[1], b[2], b[3]), u);
+        v[0] = r.x;
+        v[1] = r.y;
+        v[2] = r.z;
+        v[3] = r.w;
+        return;
+    }
+    else
+        for (unsigned c = 0; c < w; c++)
+            v[c] = a[c] + u * (b[c] - a[c]);
+
+    // the keys lie on one hemisphere, so the blend normalizes to nlerp
+    if (w == 4) {
+        Quaternion r = normal(Quaternion(v[0], v[1], v[2], v[3]));
+        v[0] = r.x;
+        v[1] = r.y;
+        v[2] = r.z;
+        v[3] = r.w;
+    }
+}
+
+// pose sets the frame's transformation to the sampled scale, rotation and
+// translation in p followed by the base transformation
+//
+void Animation::pose(const float* p) const {
+
+    const float* s = p + 7;
+    Matrix m = rotate(Quaternion(p[3], p[4], p[5], p[6]));
+    m.m11 *= s[0]; m.m12 *= s[0]; m.m13 *= s[0];
+    m.m21 *= s[1]; m.m22 *= s[1]; m.m23 *= s[1];
+    m.m31 *= s[2]; m.m32 *= s[2]; m.m33 *= s[2];
+    m.m41  = p[0];
+    m.m42  = p[1];
+    m.m43  = p[2] * MODEL_Z_AXIS;
+    frame->setLocal(m * base);
+}
+
+// destructor releases the clip and removes the animation from the
+// coordinator
+//
+Animation::~Animation() {
+
+    if (!--clip->refs) delete clip;
+    coordinator->remove(this);
+}
+
+//-------------------------------- UpdateAnimations ---------------------------
+//
+// UpdateAnimations advances every playing animation that is bound to a
+// frame and samples their tracks in one sweep per track - the animations
+// are ordered by clip so that the instances of a clip read its keys while
+// they are still in the cache - and then poses the frames
+//
+// the rotation segments are gathered by interpolation into quaternion
+// arrays and blended by the QuaternionBatch functions several at a time
+//
+// offsets of the tracks within a sampled pose of 10 floats
+static const unsigned offset[ANIMATION_TRACKS] = {0, 3, 7};
+
+// RotationBatch holds the rotation segments of one interpolation - the
+// keys a and b, the control rotations of squad, the fractions and the
+// poses that receive the blends
+//
+struct RotationBatch {
+    std::vector<float>    q[4][4]; // x y z w of a, b, control a, control b
+    std::vector<float>    t;       // fraction of the way from a to b
+    std::vector<unsigned> pose;    // pose that receives the blend
+
+    void clear() {
+        for (unsigned k = 0; k < 4; k++)
+            for (unsigned c = 0; c < 4; c++)
+                q[k][c].clear();
+        t.clear();
+        pose.clear();
+    }
+    void add(unsigned k, const float* v) {
+        for (unsigned c = 0; c < 4; c++)
+            q[k][c].push_back(v[c]);
+    }
+    QuaternionArrays arrays(unsigned k) {
+        QuaternionArrays a = {&q[k][0][0], &q[k][1][0], &q[k][2][0],
+         &q[k][3][0]};
+        return a;
+    }
+};
+
+void UpdateAnimations(iAnimation* const* a, unsigned n) {
+
+    static std::vector<std::pair<const void*, Animation*> > active;
+    static std::vector<float> sampled;
+    static RotationBatch linear, spherical, cubic;
+
+    active.clear();
+    for (unsigned i = 0; i < n; i++) {
+        Animation* m = (Animation*)a[i];
+        if (m && m->playing && m->frame) {
+            m->step();
+            active.push_back(std::make_pair((const void*)m->clip, m));
+        }
+    }
+    if (active.empty()) return;
+    std::sort(active.begin(), active.end());
+
+    unsigned na = active.size();
+    sampled.resize(10 * na);
+    for (unsigned k = 0; k < ANIMATION_TRACKS; k += 2)
+        for (unsigned i = 0; i < na; i++)
+            active[i].second->sample(k, &sampled[10 * i + offset[k]]);
+
+    // gather the rotation segments - held keys are sampled directly
+    linear.clear();
+    spherical.clear();
+    cubic.clear();
+    for (unsigned i = 0; i < na; i++) {
+        Animation* m = active[i].second;
+        const AnimationTrack& track = m->clip->track[1];
+        unsigned j;
+        float u;
+        if (!m->locate(1, j, u)) {
+            m->sample(1, &sampled[10 * i + offset[1]]);
+            continue;
+        }
+        const float* key = &track.value[4 * j];
+        RotationBatch& b = track.mode == INTERPOLATE_SLERP ? spherical :
+         track.mode == INTERPOLATE_CUBIC ? cubic : linear;
+        b.add(0, key);
+        b.add(1, key + 4);
+        b.t.push_back(u);
+        b.pose.push_back(i);
+        if (&b == &cubic) {
+            Quaternion qa(key[0], key[1], key[2], key[3]);
+            Quaternion qb(key[4], key[5], key[6], key[7]);
+            Quaternion qp = j ? Quaternion(key[-4], key[-3], key[-2],
+             key[-1]) : qa;
+            Quaternion qn = j + 2 < track.time.size() ? Quaternion(key[8],
+             key[9], key[10], key[11]) : qb;
+            Quaternion sa = squadControl(qp, qa, qb);
+            Quaternion sb = squadControl(qa, qb, qn);
+            float ca[4] = {sa.x, sa.y, sa.z, sa.w};
+            float cb[4] = {sb.x, sb.y, sb.z, sb.w};
+            b.add(2, ca);
+            b.add(3, cb);
+        }
+    }
+
+    // blend each batch into its first keys and scatter them into the poses
+    RotationBatch* batch[] = {&linear, &spherical, &cubic};
+    for (unsigned k = 0; k < 3; k++) {
+        RotationBatch& b = *batch[k];
+        unsigned nb = b.pose.size();
+        if (!nb) continue;
+        QuaternionArrays r = b.arrays(0);
+        if (k == 0)
+            nlerp(r, b.arrays(1), &b.t[0], r, nb);
+        else if (k == 1)
+            slerp(r, b.arrays(1), &b.t[0], r, nb);
+        else
+            squad(r, b.arrays(1), b.arrays(2), b.arrays(3), &b.t[0], r, nb);
+        for (unsigned i = 0; i < nb; i++) {
+            float* v = &sampled[10 * b.pose[i] + offset[1]];
+            v[0] = r.x[i];
+            v[1] = r.y[i];
+            v[2] = r.z[i];
+            v[3] = r.w[i];
+        }
+    }
+
+    for (unsigned i = 0; i < na; i++)
+        active[i].second->pose(&sampled[10 * i]);
+}
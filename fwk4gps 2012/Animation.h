@@ -0,0 +1,81 @@
+#ifndef _ANIMATION_H_
+#define _ANIMATION_H_
+
+/* Animation Definition - Modelling Layer
+ *
+ * Animation.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <vector>
+#include "iAnimation.h"       // for the Animation Interface
+#include "MathDeclarations.h" // for Matrix
+
+//-------------------------------- Animation ----------------------------------
+//
+// The Animation class plays a clip of keyframed translation, rotation and
+// scale tracks on the frame to which it is bound - the clip poses the 
+// frame relative to the frame's transformation at the time of binding
+//
+// a clip stores each track as one array of key times and one array of 
+// packed key values - clones share the clip until one of them changes it
+//
+#define ANIMATION_TRACKS 3 // translation, rotation and scale
+
+struct AnimationTrack {
+    Interpolation      mode;  // interpolation between keys
+    unsigned           width; // floats per key - 3 or 4
+    std::vector<float> time;  // key times in seconds - ascending
+    std::vector<float> value; // width floats per key
+};
+
+class Animation : public iAnimation {
+
+    struct Clip {
+        unsigned       refs;   // number of animations sharing the clip
+        float          length; // time of the last key in seconds
+        AnimationTrack track[ANIMATION_TRACKS];
+    };
+
+    Clip*    clip;     // points to the shared tracks
+    iFrame*  frame;    // frame that the clip poses - nullptr if unbound
+    Matrix   base;     // transformation of the frame when bound
+    float    time;     // current time in the clip in seconds
+    float    speed;    // clip seconds per second
+    bool     playing;  // clip is advancing?
+    bool     loop;     // clip wraps at its end?
+    unsigned lastStep; // time of the last update
+    unsigned cursor[ANIMATION_TRACKS]; // key last sampled on each track
+
+    Animation& operator=(const Animation&);
+    virtual ~Animation();
+    void  unshare();
+    void  addKey(unsigned k, float t, const float* v);
+    void  step();
+    bool  locate(unsigned k, unsigned& i, float& u);
+    void  sample(unsigned k, float* v);
+    void  pose(const float* p) const;
+
+  public:
+    Animation();
+    Animation(const Animation& src);
+    void* clone() const             { return new Animation(*this); }
+    void  addTranslation(float t, const Vector& v);
+    void  addRotation(float t, const Quaternion& q);
+    void  addScale(float t, const Vector& s);
+    void  setInterpolation(Interpolation t, Interpolation r, Interpolation s);
+    void  bind(iFrame* f);
+    void  play(bool loop = true);
+    void  stop()                    { playing = false; }
+    void  setSpeed(float s)         { speed = s; }
+    void  setTime(float t);
+    bool  isPlaying() const         { return playing; }
+    float duration() const          { return clip->length; }
+    friend void UpdateAnimations(iAnimation* const*, unsigned);
+};
+
+#endif
@@ -0,0 +1,291 @@
+/* AssetLoader Implementation - Modelling Layer
+ *
+ * AssetLoader.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <cstring>           // for memcpy
+#include "AssetLoader.h"     // for the AssetLoader class definition
+#include "iAPIMappedFile.h"  // for the APIMappedFile Interface
+
+//-------------------------------- AssetLoader --------------------------------
+//
+// The AssetLoader class runs asynchronous loading jobs on a pool of worker
+// threads - requests wait in queue until a worker takes the one with the
+// highest priority, move to loading while the worker runs the job's load
+// and to done once it returns - the main thread completes the jobs in done
+// at the start of each frame so that only the main thread touches design
+// items and the device
+//
+// CreateAssetLoader creates an AssetLoader object with the specified number
+// of workers - 0 for one less than the number of hardware threads
+//
+iAssetLoader* CreateAssetLoader(unsigned threads) {
+
+    return new AssetLoader(threads);
+}
+
+// readAsset reads the whole of file into a new array - mapping the file
+// and copying its view faults the pages in on the calling thread
+//
+unsigned char* readAsset(const wchar_t* file, unsigned& size) {
+
+    unsigned char* data = nullptr;
+    size = 0;
+
+    iAPIMappedFile* m = file ? CreateAPIMappedFile(file) : nullptr;
+    if (m) {
+        size = m->size();
+        data = new unsigned char[size];
+        memcpy(data, m->data(), size);
+        m->Delete();
+    }
+
+    return data;
+}
+
+// constructor initializes the lists and the statistics - the workers start
+// with the first request
+//
+AssetLoader::AssetLoader(unsigned threads) : stop(false), next(1),
+ completed(0), failed(0), latency(0), maxLatency(0) {
+
+    if (!threads) {
+        threads = std::thread::hardware_concurrency();
+        threads = threads > 1 ? threads - 1 : 1;
+    }
+    nWorkers = threads;
+}
+
+// find returns the position of the request with the specified handle in v
+// - -1 if v does not hold the request
+//
+int AssetLoader::find(const std::vector<Request>& v, unsigned handle) {
+
+    for (unsigned i = 0; i < v.size(); i++)
+        if (v[i].handle == handle)
+            return i;
+
+    return -1;
+}
+
+// request queues job with the specified priority and returns its handle -
+// the loader owns job from this point on
+//
+unsigned AssetLoader::request(iAssetJob* job, int priority) {
+
+    if (!job) return 0;
+
+    Request r = { job, 0, priority, now, false, false };
+    {
+        std::unique_lock<std::mutex> l(lock);
+        if (stop) {
+            l.unlock();
+            job->Delete();
+            return 0;
+        }
+        r.handle = next++;
+        if (!next) next = 1;
+        queue.push_back(r);
+        while (worker.size() < nWorkers)
+            worker.push_back(std::thread(work, this));
+    }
+    wake.notify_one();
+
+    return r.handle;
+}
+
+// work takes the queued request with the highest priority - the oldest if
+// several share that priority - runs its load and moves it to done until
+// the loader stops
+//
+void AssetLoader::work(AssetLoader* loader) {
+
+    std::unique_lock<std::mutex> l(loader->lock);
+    for (;;) {
+        while (!loader->stop && loader->queue.empty())
+            loader->wake.wait(l);
+        if (loader->stop) break;
+
+        std::vector<Request>& q = loader->queue;
+        unsigned best = 0;
+        for (unsigned i = 1; i < q.size(); i++)
+            if (q[i].priority > q[best].priority)
+                best = i;
+        Request r = q[best];
+        q.erase(q.begin() + best);
+        loader->loading.push_back(r);
+
+        l.unlock();
+        bool loaded = r.job->load();
+        l.lock();
+
+        int i = find(loader->loading, r.handle);
+        r = loader->loading[i];
+        r.loaded = loaded;
+        loader->loading.erase(loader->loading.begin() + i);
+        loader->done.push_back(r);
+    }
+}
+
+// state returns the stage that the request with the specified handle has
+// reached
+//
+AssetState AssetLoader::state(unsigned handle) const {
+
+    std::unique_lock<std::mutex> l(lock);
+    AssetState s = ASSET_DONE;
+    if (find(queue, handle) >= 0)
+        s = ASSET_QUEUED;
+    else if (find(loading, handle) >= 0)
+        s = ASSET_LOADING;
+    else if (find(done, handle) >= 0)
+        s = ASSET_LOADED;
+
+    return s;
+}
+
+// reprioritize changes the priority of the request with the specified
+// handle - has no effect once a worker has taken the request
+//
+void AssetLoader::reprioritize(unsigned handle, int priority) {
+
+    std::unique_lock<std::mutex> l(lock);
+    int i = find(queue, handle);
+    if (i >= 0)
+        queue[i].priority = priority;
+}
+
+// cancel withdraws the request with the specified handle - a queued job is
+// deleted immediately, a job in progress is deleted at the hand-off without
+// being completed - the design item that made the request calls cancel
+// before it is destroyed
+//
+void AssetLoader::cancel(unsigned handle) {
+
+    iAssetJob* job = nullptr;
+    {
+        std::unique_lock<std::mutex> l(lock);
+        int i;
+        if ((i = find(queue, handle)) >= 0) {
+            job = queue[i].job;
+            queue.erase(queue.begin() + i);
+        }
+        else if ((i = find(loading, handle)) >= 0)
+            loading[i].cancelled = true;
+        else if ((i = find(done, handle)) >= 0)
+            done[i].cancelled = true;
+    }
+    if (job)
+        job->Delete();
+}
+
+// handOff completes at most max of the loaded requests - the ones with the
+// highest priority first - and returns the number completed - called by
+// the main thread at a frame boundary
+//
+unsigned AssetLoader::handOff(unsigned max) {
+
+    std::vector<Request> ready;
+    {
+        std::unique_lock<std::mutex> l(lock);
+        for (unsigned i = 0; i < done.size(); ) {
+            if (done[i].cancelled) {
+                ready.push_back(done[i]);
+                done.erase(done.begin() + i);
+            }
+            else
+                i++;
+        }
+        for (unsigned n = 0; n < max && !done.empty(); n++) {
+            unsigned best = 0;
+            for (unsigned i = 1; i < done.size(); i++)
+                if (done[i].priority > done[best].priority)
+                    best = i;
+            ready.push_back(done[best]);
+            done.erase(done.begin() + best);
+        }
+    }
+
+    unsigned n = 0;
+    for (unsigned i = 0; i < ready.size(); i++) {
+        Request& r = ready[i];
+        if (!r.cancelled) {
+            unsigned t = now - r.requested;
+            r.job->complete(r.loaded);
+            completed++;
+            if (!r.loaded) failed++;
+            latency += t;
+            if (t > maxLatency) maxLatency = t;
+            n++;
+        }
+        r.job->Delete();
+    }
+
+    return n;
+}
+
+// pending returns the number of requests that have not been handed off
+//
+unsigned AssetLoader::pending() const {
+
+    std::unique_lock<std::mutex> l(lock);
+
+    return queue.size() + loading.size() + done.size();
+}
+
+// stats returns the depths of the lists and the latencies of the requests
+// handed off so far
+//
+AssetStats AssetLoader::stats() const {
+
+    AssetStats s;
+    {
+        std::unique_lock<std::mutex> l(lock);
+        s.queued  = queue.size();
+        s.loading = loading.size();
+        s.waiting = done.size();
+    }
+    s.completed      = completed;
+    s.failed         = failed;
+    s.averageLatency = completed ? (unsigned)(latency / completed) : 0;
+    s.maximumLatency = maxLatency;
+
+    return s;
+}
+
+// release stops the workers once their current jobs return and deletes the
+// jobs that have not been handed off - no further requests are accepted
+//
+void AssetLoader::release() {
+
+    {
+        std::unique_lock<std::mutex> l(lock);
+        stop = true;
+    }
+    wake.notify_all();
+    for (unsigned i = 0; i < worker.size(); i++)
+        worker[i].join();
+    worker.clear();
+
+    for (unsigned i = 0; i < queue.size(); i++)
+        queue[i].job->Delete();
+    for (unsigned i = 0; i < loading.size(); i++)
+        loading[i].job->Delete();
+    for (unsigned i = 0; i < done.size(); i++)
+        done[i].job->Delete();
+    queue.clear();
+    loading.clear();
+    done.clear();
+}
+
+// destructor stops the workers
+//
+AssetLoader::~AssetLoader() {
+
+    release();
+}
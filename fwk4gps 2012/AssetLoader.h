@@ -0,0 +1,71 @@
+#ifndef _ASSET_LOADER_H_
+#define _ASSET_LOADER_H_
+
+/* AssetLoader Definition - Modelling Layer
+ *
+ * AssetLoader.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <vector>
+#include <thread>             // for thread
+#include <mutex>              // for mutex, unique_lock
+#include <condition_variable> // for condition_variable
+#include "iAssetLoader.h"     // for the AssetLoader Interface
+
+//-------------------------------- AssetLoader --------------------------------
+//
+// The AssetLoader class loads assets on a pool of worker threads in order
+// of priority and hands the loaded assets back to the main thread at a
+// frame boundary
+//
+class AssetLoader : public iAssetLoader {
+
+    struct Request {
+        iAssetJob* job;       // work to be done
+        unsigned   handle;    // identifies the request
+        int        priority;  // higher priorities are loaded first
+        unsigned   requested; // system time of the request
+        bool       loaded;    // load succeeded?
+        bool       cancelled; // hand-off should discard the job?
+    };
+
+    std::vector<std::thread> worker;    // worker threads - started lazily
+    unsigned                 nWorkers;  // number of workers to start
+    mutable std::mutex       lock;      // guards the lists and stop
+    std::condition_variable  wake;      // signals a queued request or stop
+    std::vector<Request>     queue;     // requests waiting for a worker
+    std::vector<Request>     loading;   // requests being loaded
+    std::vector<Request>     done;      // requests waiting for the hand-off
+    bool                     stop;      // workers should exit?
+    unsigned                 next;      // handle of the next request
+
+    // statistics - main thread only
+    unsigned                 completed; // requests handed off
+    unsigned                 failed;    // requests whose load failed
+    double                   latency;   // sum of request to hand-off times
+    unsigned                 maxLatency; // longest request to hand-off
+
+    AssetLoader(const AssetLoader&);
+    AssetLoader& operator=(const AssetLoader&);
+    virtual ~AssetLoader();
+    static void work(AssetLoader* loader);
+    static int  find(const std::vector<Request>& v, unsigned handle);
+
+  public:
+    AssetLoader(unsigned threads);
+    unsigned   request(iAssetJob* job, int priority = 0);
+    AssetState state(unsigned handle) const;
+    void       reprioritize(unsigned handle, int priority);
+    void       cancel(unsigned handle);
+    unsigned   handOff(unsigned max);
+    unsigned   pending() const;
+    AssetStats stats() const;
+    void       release();
+};
+
+#endif
@@ -1,519 +1,1125 @@
-/* Coordinator Implementation - Modelling Layer
- *
- * Coordinator.cpp
- * fwk4gps version 3.0
- * gam666/dps901/gam670/dps905
- * January 14 2012
- * copyright (c) 2012 Chris Szalwinski 
- * distributed under TPL - see ../Licenses.txt
- */
-
-#include "Coordinator.h"     // for the Coordinator class definition
-#include "iAPIWindow.h"      // for the API Window Interface
-#include "iAPIUserInput.h"   // for the APIUserInput Interface
-#include "iAPIDisplay.h"     // for the APIDisplay Interface
-#include "iAPIAudio.h"       // for the APIAudio Interface
-#include "iUtilities.h"      // for strcpy, sprintf, strcmp
-#include "Camera.h"          // for the Camera class definition
-#include "iObject.h"         // for the Object Interface
-#include "iTexture.h"        // for the Texture Interface
-#include "iLight.h"          // for the Light Interface
-#include "iSound.h"          // for the Sound Interface
-#include "iGraphic.h"        // for the Graphic Interface
-#include "iText.h"           // for the Text Interface
-#include "iHUD.h"            // for the HUD Interface
-#include "ModellingLayer.h"  // for macros
-#include "MathDefinitions.h" // for ::projection
-#include "Common_Symbols.h"  // for Action and Sound enumerations
-#define FPS_MAX 200
-#define UNITS_PER_SEC 1000
-
-//-------------------------------- Coordinator --------------------------------
-//
-// The Coordinator object manages the design items of the Modelling Layer
-//
-iCoordinator* CoordinatorAddress() { return Coordinator::Address(); }
-
-// constructor initializes the reference time and sets the current camera
-// and HUD
-//
-Coordinator::Coordinator(void* hinst, int show) {
-
-    coordinator = this;
-    window      = CreateAPIWindow(hinst, show);
-    userInput   = CreateAPIUserInput(AUDIO_DIRECTORY);
-    display     = CreateAPIDisplay();
-    audio       = CreateAPIAudio(1.0f, MIN_VOLUME, MAX_VOLUME, MIN_FREQUENCY, 
-     MAX_FREQUENCY, DEFAULT_VOLUME, DEFAULT_FREQUENCY);
-
-    // timers
-    now              = 0;
-    lastReset        = 0;
-    lastUpdate       = 0;
-    lastCameraToggle = 0;
-    lastHUDToggle    = 0;
-    framecount       = 0;
-    fps              = 0;
-
-    // current camera and HUD
-    currentCam = 0;
-    currentHUD = 0;
-
-    // volume and frequency settings
-    frequency = DEFAULT_FREQUENCY;
-    volume    = DEFAULT_VOLUME;
-
-    // pointers
-    timerText  = nullptr;
-    background = nullptr;
-
-    // projection parameters are updated
-    fov    = 0.9f;
-    nearcp = 1.0f;
-    farcp  = 1000.0f;
-}
-
-// getConfiguration retrieves the configuration selection from the user
-//
-bool Coordinator::getConfiguration() { 
-    
-    bool rc = false;
-
-    if (userInput->getConfiguration()) {
-        release();
-        userInput->configure();         
-        window->configure();
-        if (window->setup() && userInput->setup() && display->setup() && 
-         audio->setup()) {
-            Matrix p = ::projection(fov, window->aspectRatio(), nearcp, farcp);
-            display->setProjection(&p);
-            rc = true;
-        }
-    }
-
-    // reset timers
-    now = window->time();
-    lastUpdate = now;
-    lastReset  = now;
-
-    return rc;
-}
-
-// reset resets the configuration
-//
-void Coordinator::reset() {
-
-    if (getConfiguration()) {
-        // reset the sound files
-	    for (unsigned i = 0; i < sound.size(); i++) {
-            if (sound[i]->relFileName() && 
-    	     strcmp(soundFile((ModelSound)i), sound[i]->relFileName()))
-		     sound[i]->change(soundFile((ModelSound)i));
-        }
-    }
-}
-
-// processMessages processes the next message in the message queue 
-// returns false if queue is empty
-//
-int Coordinator::run() {
-
-	int  rc = 0;
-    bool keepgoing;
-
-    // configure and initialize the application
-    if (keepgoing = getConfiguration()) {
-        initialize();
-        now = window->time();
-        lastUpdate = now;
-        lastReset  = now;
-    }
-
-	while (keepgoing) {
-        // process all system messages as the first priority
-		if (window->processMessages(rc, keepgoing)) 
-            ; // intentional
-        else if (!active)
-            window->wait();
-        else {
-            // opportunity to render a frame if no messages
-            now = window->time();
-            // render only if sufficient time has elapsed since the last frame
-	        if (now - lastUpdate >= UNITS_PER_SEC / FPS_MAX) {
-                // render the frame
-                render();
-                // update the reference time
-                lastUpdate = now;
-            }
-        }
-	}
-
-    return rc;
-}
-
-// setAmbientLight sets the colour of the background lighting
-//
-void Coordinator::setAmbientLight(float r, float g, float b) {
-
-    ambient = Colour(r, g, b); 
-}
-
-// setProjection sets the angle and clipping planes for the projection matrix
-//
-void Coordinator::setProjection(float angle, float n, float f) {
-
-    fov    = angle;
-    nearcp = n;
-    farcp  = f;
-}
-
-// pressed returns the on/off status of Action a
-//
-bool Coordinator::pressed(Action a) const { return userInput->pressed(a); }
-
-// ptrPressed returns the on/off status of Action a
-//
-bool Coordinator::ptrPressed() const { return userInput->ptrPressed(); }
-
-// ctrPressed returns the on/off status of Action a
-//
-bool Coordinator::ctrPressed() const { return userInput->ctrPressed(); }
-
-// change returns the change caused by Action a 
-//
-int Coordinator::change(Action a) const { return userInput->change(a); }
-
-// soundFile returns the address of the soundFile associated with ModelSound s
-//
-const wchar_t* Coordinator::soundFile(ModelSound s) const { 
-    
-    return userInput->soundFile(s); 
-}
-
-// adjustVolume adjusts the volume of the audio system by factor *
-// incVolume - positive factor increases the volume, negative factor
-// decreases the volume
-//
-void Coordinator::adjustVolume(int factor) {
-
-    if (factor > 0)
-        volume += STEP_VOLUME;
-    else if (factor < 0)
-        volume -= STEP_VOLUME;
-    if (volume > MAX_VOLUME)
-        volume = MAX_VOLUME;
-    else if (volume < MIN_VOLUME)
-        volume = MIN_VOLUME;
-}
-
-// adjustFrequency adjusts the frequency of the audio system by factor *
-// incVolume - positive factor increases the volume, negative factor
-// decreases the volume
-//
-void Coordinator::adjustFrequency(int factor) {
-
-    if (factor < 0) {
-        frequency = frequency + STEP_FREQUENCY;
-        frequency = frequency < MIN_FREQUENCY ? MIN_FREQUENCY : frequency;
-    }
-    else if (factor > 0) {
-        frequency = frequency + STEP_FREQUENCY;
-        frequency = frequency > MAX_FREQUENCY ? MAX_FREQUENCY : frequency;
-    }
-}
-
-// update updates the current Camera and HUD objects, the lights and the sounds
-//
-void Coordinator::update() {
-
-	// toggle and update the current camera
-	if (camera.size() && userInput->pressed(CAMERA_SELECT) && 
-        now - lastCameraToggle > KEY_LATENCY) {
-        lastCameraToggle = now;
-        currentCam++;
-        if (currentCam == camera.size())
-            currentCam = 0;
-    }
-    if (camera.size() && camera[currentCam])
-        camera[currentCam]->update();
-
-	// toggle and update the current hud
-	if (hud.size() && userInput->pressed(HUD_SELECT) &&
-        now - lastHUDToggle > KEY_LATENCY) {
-        lastHUDToggle = now;
-        currentHUD++;
-        if (currentHUD == hud.size())
-            currentHUD = 0;
-    }
-    if (hud.size() && hud[currentHUD] && userInput->pressed(HUD_DISPLAY))
-        hud[currentHUD]->toggle();
-    if (hud.size() && hud[currentHUD]) 
-        hud[currentHUD]->update();
-
-    // update the volume and the frequency
-	if (now - lastUpdate > KEY_LATENCY) {
-
-		if (userInput->pressed(AUD_VOLUME_DEC))
-			adjustVolume(-1);
-		if (userInput->pressed(AUD_VOLUME_INC))
-			adjustVolume(1);
-
-        if (userInput->pressed(AUD_FREQ_DEC))
-            adjustFrequency(-1);
-        else if (userInput->pressed(AUD_FREQ_INC))
-            adjustFrequency(1);
-	}	
-
-    // update the sound sources
-    for (unsigned i = 0; i < sound.size(); i++)
-		if (sound[i]) 
-			sound[i]->update();
-
-	// update the light sources
-    for (unsigned i = 0; i < light.size(); i++)
-		if (light[i])
-			light[i]->update();
-}
-
-// renders draws a complete frame
-//
-void Coordinator::render() {
-
-	// adjust framecount and fps
-    if (now - lastReset <= unitsPerSec) 
-		framecount++;
-	else {
-        // recalculate the frame rate
-        fps        = framecount * unitsPerSec / (now - lastReset);
-		framecount = 0;
-		lastReset  = now;
-        if (timerText) {
-            wchar_t str[MAX_DESC + 1];
-            sprintf(str, fps, L" fps");
-	        timerText->set(str);
-        }
-	}
-    // update the user input devices
-    userInput->update();
-    Coordinator::update();
-    // update the model
-    update();
-    // update the audio
-    audio->setVolume(volume);
-    audio->setFrequencyRatio(frequency);
-    audio->update(Camera::getView());
-
-    // start rendering
-    display->beginDrawFrame(Camera::getView());
-    if (background) { 
-        Rectf fullScreen(0, 0, 1, 1);
-        display->beginDrawHUD(0);
-        background->render(fullScreen, true);
-        display->endDrawHUD();
-    }
-    display->setAmbientLight(ambient.r, ambient.g, ambient.b);
-    render(OPAQUE_OBJECT);
-    display->set(ALPHA_BLEND, true);
-    render(TRANSLUCENT_OBJECT);
-    display->set(ALPHA_BLEND, false);
-    display->beginDrawHUD(HUD_ALPHA);
-    render(ALL_HUDS);
-    display->endDrawHUD();
-    display->endDrawFrame();
-    render(ALL_SOUNDS);
-}
-
-// render draws the coordinator elements for the specified Category
-//
-void Coordinator::render(Category category) {
-
-    switch (category) {
-        case ALL_OBJECTS:
-            // draw all objects
-            for (unsigned i = 0; i < object.size(); i++) {
-		        if (object[i])
-                    render(object[i]);
-            }
-            break;
-        case ALL_HUDS:
-            // draw all huds
-            for (unsigned i = 0; i < hud.size(); i++)
-                if (hud[i] && hud[i]->isOn())
-                    hud[i]->render();
-            for (unsigned i = 0; i < text.size(); i++)
-                if (text[i] && text[i]->getHUD() && text[i]->getHUD()->isOn())
-                    text[i]->render();
-            break;
-        case ALL_SOUNDS:
-            // render all sounds
-            for (unsigned i = 0; i < sound.size(); i++)
-		        if (sound[i]) 
-			        sound[i]->render();
-            break;
-        default:
-            // draw objects that only belong to category
-            for (unsigned i = 0; i < object.size(); i++) {
-		        if (object[i] && object[i]->belongsTo(category))
-                    render(object[i]);
-            }
-    }
-}
-
-// render draws a single object (*object) 
-//
-void Coordinator::render(iObject* object) {
-
-    display->setWorld(&object->world());
-    iTexture* texture = object->getTexture();
-    if (texture) texture->attach();
-    const void* reflectivity = object->getReflectivity();
-    if (reflectivity)
-        display->setReflectivity(reflectivity);
-    else
-        display->set(LIGHTING, false);
-    object->render();
-    if (!reflectivity)
-        display->set(LIGHTING, true);
-    if (texture) texture->detach();
-}
-
-// resize resizes the window and the user interface
-//
-void Coordinator::resize() {
-
-    if (active && window->getWindowMode()) {
-        window->resize();
-        Matrix p = ::projection(fov, window->aspectRatio(), nearcp, farcp);
-        display->setProjection(&p);
-    }
-}
-
-// suspend suspends all of the design items
-//
-void Coordinator::suspend() {
-
-	for (unsigned i = 0; i < texture.size(); i++)
-		if (texture[i])
-			texture[i]->suspend();
-
-	for (unsigned i = 0; i < light.size(); i++)
-		if (light[i])
-			light[i]->suspend();
-
-    for (unsigned i = 0; i < sound.size(); i++)
-		if (sound[i]) 
-			sound[i]->suspend();
-
-    for (unsigned i = 0; i < graphic.size(); i++)
-		if (graphic[i]) 
-			graphic[i]->suspend();
-
-    for (unsigned i = 0; i < text.size(); i++)
-        if (text[i])
-			text[i]->suspend();
-
-    display->suspend();
-    userInput->suspend();
-    audio->suspend();
-    active = false;
-}
-
-// restore restores all of the design items and initializes the timers
-//
-void Coordinator::restore() {
-
-    now = window->time();
-    userInput->restore();
-    display->restore();
-    Matrix p = ::projection(fov, window->aspectRatio(), nearcp, farcp);
-    display->setProjection(&p);
-    audio->restore();
-
-    for (unsigned i = 0; i < camera.size(); i++)
-        if (camera[i])
-			camera[i]->restore();
-	for (unsigned i = 0; i < light.size(); i++)
-		if (light[i])
-			light[i]->restore();
-	for (unsigned i = 0; i < sound.size(); i++)
-		if (sound[i]) 
-			sound[i]->restore();
-    for (unsigned i = 0; i < hud.size(); i++)
-        if (hud[i])
-			hud[i]->restore();
-    for (unsigned i = 0; i < text.size(); i++)
-        if (text[i])
-			text[i]->restore();
-
-    lastCameraToggle = now;
-    lastHUDToggle    = now;
-    lastUpdate       = now;
-    active           = true;
-}
-
-// release releases the design items
-//
-void Coordinator::release() {
-
-	for (unsigned i = 0; i < texture.size(); i++)
-		if (texture[i])
-			texture[i]->release();
-
-    for (unsigned i = 0; i < graphic.size(); i++)
-		if (graphic[i]) 
-			graphic[i]->release();
-
-    for (unsigned i = 0; i < text.size(); i++)
-        if (text[i])
-			text[i]->release();
-
-    for (unsigned i = 0; i < sound.size(); i++)
-        if (sound[i])
-			sound[i]->release();
-
-    display->release();
-    userInput->release();
-    audio->release();
-    window->release();
-}
-
-// destructor deletes all of the coordinator elements
-//
-Coordinator::~Coordinator() {
-
-    for (unsigned i = 0; i < object.size(); i++)
-        if (object[i]) 
-            object[i]->Delete();
-
-    for (unsigned i = 0; i < texture.size(); i++)
-        if (texture[i]) 
-            texture[i]->Delete();
-
-    for (unsigned i = 0; i < light.size(); i++)
-        if (light[i])
-            light[i]->Delete();
-
-    for (unsigned i = 0; i < camera.size(); i++)
-        if (camera[i])
-            camera[i]->Delete();
-
-    for (unsigned i = 0; i < sound.size(); i++)
-        if (sound[i])
-            sound[i]->Delete();
-
-    for (unsigned i = 0; i < graphic.size(); i++)
-        if (graphic[i])
-            graphic[i]->Delete();
-
-    for (unsigned i = 0; i < text.size(); i++)
-        if (text[i]) 
-			text[i]->Delete();
-
-    display->Delete();
-    userInput->Delete();
-    audio->Delete();
-	window->Delete();
-
-    coordinator = nullptr;
-}
-
+/* Coordinator Implementation - Modelling Layer
+ *
+ * Coordinator.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <cstring>           // for memcmp
+#include <algorithm>         // for sort, lower_bound, min, max
+#include "Coordinator.h"     // for the Coordinator class definition
+#include "iAPIWindow.h"      // for the API Window Interface
+#include "iAPIUserInput.h"   // for the APIUserInput Interface
+#include "iAPIDisplay.h"     // for the APIDisplay Interface
+#include "iAPIAudio.h"       // for the APIAudio Interface
+#include "iUtilities.h"      // for strcpy, sprintf, strcmp
+#include "Camera.h"          // for the Camera class definition
+#include "iObject.h"         // for the Object Interface
+#include "iTexture.h"        // for the Texture Interface
+#include "iLight.h"          // for the Light Interface
+#include "iSound.h"          // for the Sound Interface
+#include "iGraphic.h"        // for the Graphic Interface
+#include "iText.h"           // for the Text Interface
+#include "iHUD.h"            // for the HUD Interface
+#include "iEmitter.h"        // for the Emitter Interface
+#include "iAnimation.h"      // for the Animation Interface
+#include "iAssetLoader.h"    // for the AssetLoader Interface
+#include "ModellingLayer.h"  // for macros
+#include "MathDefinitions.h" // for ::projection
+#include "Common_Symbols.h"  // for Action and Sound enumerations
+#define FPS_MAX 200
+#define UNITS_PER_SEC 1000
+
+//-------------------------------- Coordinator --------------------------------
+//
+// The Coordinator object manages the design items of the Modelling Layer
+//
+iCoordinator* CoordinatorAddress() { return Coordinator::Address(); }
+
+// constructor initializes the reference time and sets the current camera
+// and HUD
+//
+Coordinator::Coordinator(void* hinst, int show) {
+
+    coordinator = this;
+    window      = CreateAPIWindow(hinst, show);
+    userInput   = CreateAPIUserInput(AUDIO_DIRECTORY);
+    display     = CreateAPIDisplay();
+    audio       = CreateAPIAudio(1.0f, MIN_VOLUME, MAX_VOLUME, MIN_FREQUENCY, 
+     MAX_FREQUENCY, DEFAULT_VOLUME, DEFAULT_FREQUENCY);
+    loader      = CreateAssetLoader(ASSET_THREADS);
+
+    // timers
+    now              = 0;
+    lastReset        = 0;
+    lastUpdate       = 0;
+    lastCameraToggle = 0;
+    lastHUDToggle    = 0;
+    framecount       = 0;
+    fps              = 0;
+
+    // current camera and HUD
+    currentCam = 0;
+    currentHUD = 0;
+
+    // volume and frequency settings
+    frequency = DEFAULT_FREQUENCY;
+    volume    = DEFAULT_VOLUME;
+
+    // pointers
+    timerText  = nullptr;
+    background = nullptr;
+
+    // projection parameters are updated
+    fov    = 0.9f;
+    nearcp = 1.0f;
+    farcp  = 1000.0f;
+
+    // culling statistics
+    drawn  = 0;
+    culled = 0;
+
+    // prewarming
+    prewarming   = false;
+    nextPrewarm  = 0;
+    prewarmed    = 0;
+    prewarmUnits = 0;
+    restoreUnits = 0;
+}
+
+// getConfiguration retrieves the configuration selection from the user -
+// the time taken to rebuild the device for the selection, but not the time
+// that the user spends in the dialog, is recorded as the restore time
+//
+bool Coordinator::getConfiguration() { 
+    
+    bool rc = false;
+
+    if (userInput->getConfiguration()) {
+        unsigned start = window->time();
+        release();
+        userInput->configure();         
+        window->configure();
+        if (window->setup() && userInput->setup() && display->setup() && 
+         audio->setup()) {
+            projection = ::projection(fov, window->aspectRatio(), nearcp, 
+             farcp);
+            display->setProjection(&projection);
+            rc = true;
+        }
+        restoreUnits = window->time() - start;
+    }
+
+    // reset timers
+    now = window->time();
+    lastUpdate = now;
+    lastReset  = now;
+
+    return rc;
+}
+
+// reset resets the configuration
+//
+void Coordinator::reset() {
+
+    if (getConfiguration()) {
+        startPrewarm();
+        // reset the sound files
+	    for (unsigned i = 0; i < sound.size(); i++) {
+            if (sound[i]->relFileName() && 
+    	     strcmp(soundFile((ModelSound)i), sound[i]->relFileName()))
+		     sound[i]->change(soundFile((ModelSound)i));
+        }
+    }
+}
+
+// processMessages processes the next message in the message queue 
+// returns false if queue is empty
+//
+int Coordinator::run() {
+
+	int  rc = 0;
+    bool keepgoing;
+
+    // configure and initialize the application
+    if (keepgoing = getConfiguration()) {
+        initialize();
+        startPrewarm();
+        now = window->time();
+        lastUpdate = now;
+        lastReset  = now;
+    }
+
+	while (keepgoing) {
+        // process all system messages as the first priority
+		if (window->processMessages(rc, keepgoing)) 
+            ; // intentional
+        else if (!active)
+            window->wait();
+        else {
+            // opportunity to render a frame if no messages
+            now = window->time();
+            // render only if sufficient time has elapsed since the last frame
+	        if (now - lastUpdate >= UNITS_PER_SEC / FPS_MAX) {
+                // render the frame
+                render();
+                // update the reference time
+                lastUpdate = now;
+            }
+        }
+	}
+
+    return rc;
+}
+
+// add adds object *o to the coordinator in an empty slot and files it in
+// the bucket of its drawing category
+//
+void Coordinator::add(iObject* o) {
+
+    unsigned s;
+
+    if (freeSlot.size()) {
+        s = freeSlot.back();
+        freeSlot.pop_back();
+        object[s] = o;
+    }
+    else {
+        s = object.size();
+        object.push_back(o);
+        for (int c = 0; c < OBJECT_CATEGORIES; c++)
+            place[c].push_back(0);
+    }
+    slots[o] = s;
+    categorize(o);
+}
+
+// categorize files object *o in the bucket of each drawing category to which
+// it belongs and removes it from the buckets to which it no longer belongs -
+// called whenever the category of an object changes
+//
+void Coordinator::categorize(iObject* o) {
+
+    unsigned s = slot(o);
+
+    if (s < object.size()) {
+        for (int c = 0; c < OBJECT_CATEGORIES; c++) {
+            bool belongs = o->belongsTo((Category)c);
+            if (belongs && !place[c][s]) {
+                bucket[c].push_back(s);
+                place[c][s] = bucket[c].size();
+            }
+            else if (!belongs && place[c][s])
+                unfile(c, s);
+        }
+    }
+}
+
+// unfile removes slot s from bucket c by moving the last slot in the bucket
+// into its place
+//
+void Coordinator::unfile(int c, unsigned s) {
+
+    unsigned i    = place[c][s] - 1;
+    unsigned last = bucket[c].back();
+
+    bucket[c][i]   = last;
+    place[c][last] = i + 1;
+    bucket[c].pop_back();
+    place[c][s]    = 0;
+}
+
+// slot returns the index of object *o in the object table or the size of
+// the table if *o is not in the table
+//
+unsigned Coordinator::slot(const iObject* o) const {
+
+    std::unordered_map<const iObject*, unsigned>::const_iterator i =
+     slots.find(o);
+
+    return i != slots.end() ? i->second : object.size();
+}
+
+// remove removes object *o from the buckets and empties its slot in the
+// object table
+//
+void Coordinator::remove(iObject* o) {
+
+    unsigned s = slot(o);
+
+    if (s < object.size()) {
+        for (int c = 0; c < OBJECT_CATEGORIES; c++)
+            if (place[c][s])
+                unfile(c, s);
+        object[s] = nullptr;
+        freeSlot.push_back(s);
+        slots.erase(o);
+    }
+}
+
+// setAmbientLight sets the colour of the background lighting
+//
+void Coordinator::setAmbientLight(float r, float g, float b) {
+
+    ambient = Colour(r, g, b); 
+}
+
+// setProjection sets the angle and clipping planes for the projection matrix
+//
+void Coordinator::setProjection(float angle, float n, float f) {
+
+    fov    = angle;
+    nearcp = n;
+    farcp  = f;
+}
+
+// pressed returns the on/off status of Action a
+//
+bool Coordinator::pressed(Action a) const { return userInput->pressed(a); }
+
+// ptrPressed returns the on/off status of Action a
+//
+bool Coordinator::ptrPressed() const { return userInput->ptrPressed(); }
+
+// ctrPressed returns the on/off status of Action a
+//
+bool Coordinator::ctrPressed() const { return userInput->ctrPressed(); }
+
+// change returns the change caused by Action a 
+//
+int Coordinator::change(Action a) const { return userInput->change(a); }
+
+// soundFile returns the address of the soundFile associated with ModelSound s
+//
+const wchar_t* Coordinator::soundFile(ModelSound s) const { 
+    
+    return userInput->soundFile(s); 
+}
+
+// adjustVolume adjusts the volume of the audio system by factor *
+// incVolume - positive factor increases the volume, negative factor
+// decreases the volume
+//
+void Coordinator::adjustVolume(int factor) {
+
+    if (factor > 0)
+        volume += STEP_VOLUME;
+    else if (factor < 0)
+        volume -= STEP_VOLUME;
+    if (volume > MAX_VOLUME)
+        volume = MAX_VOLUME;
+    else if (volume < MIN_VOLUME)
+        volume = MIN_VOLUME;
+}
+
+// adjustFrequency adjusts the frequency of the audio system by factor *
+// incVolume - positive factor increases the volume, negative factor
+// decreases the volume
+//
+void Coordinator::adjustFrequency(int factor) {
+
+    if (factor < 0) {
+        frequency = frequency + STEP_FREQUENCY;
+        frequency = frequency < MIN_FREQUENCY ? MIN_FREQUENCY : frequency;
+    }
+    else if (factor > 0) {
+        frequency = frequency + STEP_FREQUENCY;
+        frequency = frequency > MAX_FREQUENCY ? MAX_FREQUENCY : frequency;
+    }
+}
+
+// update updates the current Camera and HUD objects, the lights and the sounds
+//
+void Coordinator::update() {
+
+	// toggle and update the current camera
+	if (camera.size() && userInput->pressed(CAMERA_SELECT) && 
+        now - lastCameraToggle > KEY_LATENCY) {
+        lastCameraToggle = now;
+        currentCam++;
+        if (currentCam == camera.size())
+            currentCam = 0;
+    }
+    if (camera.size() && camera[currentCam])
+        camera[currentCam]->update();
+
+	// toggle and update the current hud
+	if (hud.size() && userInput->pressed(HUD_SELECT) &&
+        now - lastHUDToggle > KEY_LATENCY) {
+        lastHUDToggle = now;
+        currentHUD++;
+        if (currentHUD == hud.size())
+            currentHUD = 0;
+    }
+    if (hud.size() && hud[currentHUD] && userInput->pressed(HUD_DISPLAY))
+        hud[currentHUD]->toggle();
+    if (hud.size() && hud[currentHUD]) 
+        hud[currentHUD]->update();
+
+    // update the volume and the frequency
+	if (now - lastUpdate > KEY_LATENCY) {
+
+		if (userInput->pressed(AUD_VOLUME_DEC))
+			adjustVolume(-1);
+		if (userInput->pressed(AUD_VOLUME_INC))
+			adjustVolume(1);
+
+        if (userInput->pressed(AUD_FREQ_DEC))
+            adjustFrequency(-1);
+        else if (userInput->pressed(AUD_FREQ_INC))
+            adjustFrequency(1);
+	}	
+
+    // update the sound sources
+    for (unsigned i = 0; i < sound.size(); i++)
+		if (sound[i]) 
+			sound[i]->update();
+
+	// update the light sources
+    for (unsigned i = 0; i < light.size(); i++)
+		if (light[i])
+			light[i]->update();
+}
+
+// renders draws a complete frame
+//
+void Coordinator::render() {
+
+	// adjust framecount and fps
+    if (now - lastReset <= unitsPerSec) 
+		framecount++;
+	else {
+        // recalculate the frame rate
+        fps        = framecount * unitsPerSec / (now - lastReset);
+		framecount = 0;
+		lastReset  = now;
+        if (timerText) {
+            wchar_t str[MAX_DESC + 1];
+            sprintf(str, fps, L" fps");
+	        timerText->set(str);
+        }
+	}
+    // hand the assets loaded since the last frame to their design items
+    loader->handOff(ASSET_HANDOFFS);
+    // create the API resources that have not been used yet
+    if (prewarming) prewarm();
+    // update the user input devices
+    userInput->update();
+    Coordinator::update();
+    // update the model
+    update();
+    // pose the animated frames
+    if (animation.size()) 
+        UpdateAnimations(&animation[0], animation.size());
+    // update the particle systems
+    if (emitter.size()) UpdateEmitters(&emitter[0], emitter.size());
+    // update the audio
+    audio->setVolume(volume);
+    audio->setFrequencyRatio(frequency);
+    audio->update(Camera::getView());
+
+    // start rendering
+    display->beginDrawFrame(Camera::getView());
+    if (background) { 
+        Rectf fullScreen(0, 0, 1, 1);
+        display->beginDrawHUD(0);
+        background->render(fullScreen, true);
+        display->endDrawHUD();
+    }
+    display->setAmbientLight(ambient.r, ambient.g, ambient.b);
+    cull();
+    render(OPAQUE_OBJECT);
+    display->set(ALPHA_BLEND, true);
+    render(TRANSLUCENT_OBJECT);
+    render(ALL_EMITTERS);
+    display->set(ALPHA_BLEND, false);
+    display->beginDrawHUD(HUD_ALPHA);
+    render(ALL_HUDS);
+    display->endDrawHUD();
+    display->endDrawFrame();
+    render(ALL_SOUNDS);
+}
+
+// render draws the coordinator elements for the specified Category
+//
+void Coordinator::render(Category category) {
+
+    switch (category) {
+        case ALL_OBJECTS:
+            // draw all objects
+            for (unsigned i = 0; i < object.size(); i++) {
+		        if (object[i] && !(i < merged.size() && merged[i]))
+                    render(object[i], object[i]->world());
+            }
+            break;
+        case ALL_EMITTERS:
+            // draw all particle systems - their quads are in world space,
+            // unlit and do not write depth so that they do not hide one
+            // another
+            if (emitter.size()) {
+                Matrix identity;
+                identity.isIdentity();
+                display->setWorld(&identity);
+                display->set(LIGHTING, false);
+                display->set(Z_WRITE, false);
+                for (unsigned i = 0; i < emitter.size(); i++)
+                    if (emitter[i] && emitter[i]->noParticles()) {
+                        iTexture* t = emitter[i]->getTexture();
+                        if (t) t->attach();
+                        emitter[i]->render();
+                        if (t) t->detach();
+                    }
+                display->set(Z_WRITE, true);
+                display->set(LIGHTING, true);
+            }
+            break;
+        case ALL_HUDS:
+            // draw all huds
+            for (unsigned i = 0; i < hud.size(); i++)
+                if (hud[i] && hud[i]->isOn())
+                    hud[i]->render();
+            for (unsigned i = 0; i < text.size(); i++)
+                if (text[i] && text[i]->getHUD() && text[i]->getHUD()->isOn())
+                    text[i]->render();
+            break;
+        case ALL_SOUNDS:
+            // render all sounds
+            for (unsigned i = 0; i < sound.size(); i++)
+		        if (sound[i]) 
+			        sound[i]->render();
+            break;
+        default:
+            // queue the objects filed in the category's bucket that are
+            // not outside the view frustum and draw them in key order
+            if (category < OBJECT_CATEGORIES) {
+                const std::vector<unsigned>& b = bucket[category];
+                const Matrix& v = *(const Matrix*)Camera::getView();
+                queue.clear();
+                for (unsigned i = 0; i < b.size(); i++) {
+                    unsigned s = b[i];
+                    if (s < merged.size() && merged[s])
+                        // drawn by its static batch
+                        ;
+                    else if (s >= clip.size())
+                        render(object[s], object[s]->world());
+                    else if (clip[s] != CULL_OUTSIDE) {
+                        const iObject* o = object[s];
+                        const Vector&  c = centre[s];
+                        float z = c.x * v.m13 + c.y * v.m23 + c.z * v.m33 + 
+                         v.m43;
+                        queue.add(s, category, 
+                         queue.textureId(o->getTexture(), 
+                         o->getTextureFilter()), 
+                         queue.materialId(o->getReflectivity()), 
+                         queue.graphicId(o->getGraphic()),
+                         category == TRANSLUCENT_OBJECT, 
+                         (z - nearcp) / (farcp - nearcp));
+                    }
+                    else
+                        culled++;
+                }
+                queue.sort();
+                submit();
+            }
+    }
+}
+
+// submit draws the queued items in order, changing the texture, the
+// material and the lighting state only where they differ from those of
+// the previous item - adjacent items that share a texture, a material and
+// a graphic are drawn as one group with the vertex stream bound once
+//
+void Coordinator::submit() {
+
+    iTexture* bound    = nullptr; // texture attached to the pipeline
+    unsigned  flags    = 0;       // sampling flags of the attached texture
+    unsigned  material = 0;       // material identifier set on the display
+    bool      lit      = true;    // lighting is on
+
+    for (unsigned i = 0, j; i < queue.size(); i = j) {
+        const DrawItem& item = queue[i];
+        iObject*  o = object[item.slot];
+        iTexture* t = o->getTexture();
+        iGraphic* g = o->getGraphic();
+
+        // extent of the group that starts with item i
+        for (j = i + 1; j < queue.size() && g && 
+         queue[j].graphic  == item.graphic && 
+         queue[j].texture  == item.texture &&
+         queue[j].material == item.material; j++)
+            ;
+
+        if (t != bound || (t && o->getTextureFilter() != flags)) {
+            if (bound) bound->detach();
+            if (t) t->attach();
+            bound = t;
+            flags = o->getTextureFilter();
+        }
+        if (item.material) {
+            if (!lit) {
+                display->set(LIGHTING, true);
+                lit = true;
+            }
+            if (item.material != material) {
+                display->setReflectivity(o->getReflectivity());
+                material = item.material;
+            }
+        }
+        else if (lit) {
+            display->set(LIGHTING, false);
+            lit = false;
+        }
+
+        // a single object is drawn on its own
+        if (j - i == 1) {
+            display->setWorld(&transform[item.slot]);
+            o->render();
+        }
+        // a group is drawn in one call with its world transformations
+        // packed together
+        else {
+            instance.resize(j - i);
+            for (unsigned k = i; k < j; k++)
+                instance[k - i] = transform[queue[k].slot];
+            if (t && flags) t->setFilter(flags);
+            g->render(&instance[0], j - i);
+        }
+        drawn += j - i;
+    }
+    if (!lit) display->set(LIGHTING, true);
+    if (bound) bound->detach();
+}
+
+// cull classifies every object against the view frustum of the current
+// camera and caches the world transformation of each object for drawing
+//
+void Coordinator::cull() {
+
+    unsigned n = object.size();
+    bool children = false;
+
+    drawn  = 0;
+    culled = 0;
+    queue.reset();
+    transform.resize(n);
+    centre.resize(n);
+    radius.resize(n);
+    parent.resize(n);
+    clip.resize(n);
+
+    // planes of the view frustum in world space
+    frustum.extract(*(const Matrix*)Camera::getView() * projection);
+
+    // world transformations and bounding spheres in world space
+    for (unsigned s = 0; s < n; s++) {
+        if (object[s]) {
+            Vector c;
+            transform[s] = object[s]->world();
+            radius[s]    = object[s]->boundingSphere(c, transform[s]);
+            centre[s]    = transform[s].position() + c;
+            parent[s]    = -1;
+            if (object[s]->getParent())
+                children = true;
+        }
+    }
+
+    // rebuild the static batches if a static object has been added, removed
+    // or moved
+    if (staticChanged()) {
+        bake();
+        cull();
+        return;
+    }
+
+    // link each child to the slot of its parent, if the parent is an object
+    if (children) {
+        frameSlot.clear();
+        for (unsigned s = 0; s < n; s++)
+            if (object[s])
+                frameSlot.push_back(std::make_pair((const iFrame*)object[s],
+                 s));
+        std::sort(frameSlot.begin(), frameSlot.end());
+        for (unsigned s = 0; s < n; s++) {
+            const iFrame* f = object[s] ? object[s]->getParent() : nullptr;
+            if (f) {
+                std::vector<std::pair<const iFrame*, unsigned> >::iterator i =
+                 std::lower_bound(frameSlot.begin(), frameSlot.end(), 
+                 std::make_pair(f, 0u));
+                if (i != frameSlot.end() && i->first == f)
+                    parent[s] = i->second;
+            }
+        }
+    }
+
+    classify();
+    selectLODs();
+}
+
+// selectLODs selects the level of detail of each object that has more than
+// one level and is not outside the view frustum - the distances from the
+// camera are computed together in one pass before any object is updated
+//
+void Coordinator::selectLODs() {
+
+    const iFrame* eye = *Camera::getCurrent();
+    if (!eye) return;
+
+    unsigned n = object.size();
+    lod.clear();
+    for (unsigned s = 0; s < n; s++)
+        if (object[s] && clip[s] != CULL_OUTSIDE && object[s]->noLODs() > 1)
+            lod.push_back(s);
+
+    unsigned nl = lod.size();
+    if (nl) {
+        Vector p = eye->position();
+        lodDistance.resize(nl);
+        for (unsigned i = 0; i < nl; i++)
+            lodDistance[i] = (centre[lod[i]] - p).length();
+        for (unsigned i = 0; i < nl; i++)
+            object[lod[i]]->selectLOD(lodDistance[i]);
+    }
+}
+
+// staticChanged reports whether the set of bakeable static objects or the
+// world transformation of any of them differs from those last baked
+//
+bool Coordinator::staticChanged() const {
+
+    unsigned n = object.size() > baked.size() ? object.size() : baked.size();
+
+    for (unsigned s = 0; s < n; s++) {
+        iObject* o = s < object.size() && object[s] && object[s]->isStatic() &&
+         object[s]->noLODs() < 2 ? object[s] : nullptr;
+        iObject* b = s < baked.size() ? baked[s] : nullptr;
+        if (o != b || (o && memcmp(&transform[s], &bakedWorld[s], 
+         sizeof(Matrix))))
+            return true;
+    }
+
+    return false;
+}
+
+// bake merges the static objects that share a category, a texture, a
+// material and a kind of vertex list into batches - each batch holds the 
+// vertices of its members transformed into world space and is drawn by an
+// object of its own with the identity transformation - objects with more
+// than one level of detail are left out, since they change graphic as the
+// camera moves
+//
+void Coordinator::bake() {
+
+    // discard the previous batches
+    for (unsigned i = 0; i < batchObject.size(); i++)
+        batchObject[i]->Delete();
+    for (unsigned i = 0; i < batchGraphic.size(); i++)
+        batchGraphic[i]->Delete();
+    batchObject.clear();
+    batchGraphic.clear();
+
+    unsigned n = object.size();
+    baked.assign(n, nullptr);
+    bakedWorld.resize(n);
+    merged.assign(n, 0);
+    for (unsigned s = 0; s < n; s++) {
+        if (object[s] && object[s]->isStatic() && object[s]->noLODs() < 2) {
+            baked[s]      = object[s];
+            bakedWorld[s] = transform[s];
+        }
+    }
+
+    std::vector<iGraphic*> g;
+    std::vector<Matrix>    w;
+    std::vector<unsigned>  member;
+    for (unsigned s = 0; s < n; s++) {
+        iObject* o = baked[s];
+        if (!o || merged[s] || !o->getGraphic() || !o->getGraphic()->batchKey())
+            continue;
+
+        // collect the members of the batch that starts with object s
+        unsigned    key = o->getGraphic()->batchKey();
+        Category    c   = o->belongsTo(TRANSLUCENT_OBJECT) ? 
+         TRANSLUCENT_OBJECT : OPAQUE_OBJECT;
+        const void* r   = o->getReflectivity();
+        member.clear();
+        for (unsigned t = s; t < n; t++) {
+            iObject* p = baked[t];
+            if (p && !merged[t] && p->getGraphic() &&
+             p->getGraphic()->batchKey() == key && p->belongsTo(c) &&
+             p->getTexture() == o->getTexture() &&
+             p->getTextureFilter() == o->getTextureFilter() &&
+             (r ? p->getReflectivity() && !memcmp(p->getReflectivity(), r, 
+             sizeof(Reflectivity)) : !p->getReflectivity()))
+                member.push_back(t);
+        }
+
+        // merge the members in chunks of at most MAX_BATCH_PRIMITIVES
+        for (unsigned i = 0, j; i < member.size(); i = j) {
+            unsigned np = 0;
+            bool     bounded = true;
+            Vector   lo, hi;
+            g.clear();
+            w.clear();
+            for (j = i; j < member.size() && (j == i || np + 
+             baked[member[j]]->getGraphic()->noPrimitives() <= 
+             MAX_BATCH_PRIMITIVES); j++) {
+                unsigned t = member[j];
+                float    d = radius[t];
+                np += baked[t]->getGraphic()->noPrimitives();
+                g.push_back(baked[t]->getGraphic());
+                w.push_back(transform[t]);
+                if (!d)
+                    bounded = false;
+                else if (j == i) {
+                    lo = centre[t] - Vector(d, d, d);
+                    hi = centre[t] + Vector(d, d, d);
+                }
+                else {
+                    const Vector& e = centre[t];
+                    lo = Vector(std::min(lo.x, e.x - d), 
+                     std::min(lo.y, e.y - d), std::min(lo.z, e.z - d));
+                    hi = Vector(std::max(hi.x, e.x + d), 
+                     std::max(hi.y, e.y + d), std::max(hi.z, e.z + d));
+                }
+            }
+            iGraphic* batch = o->getGraphic()->merge(&g[0], &w[0], g.size());
+            if (batch) {
+                iObject* b = CreateObject(batch, (const Reflectivity*)r);
+                b->attach(o->getTexture());
+                b->setTextureFilter(o->getTextureFilter());
+                if (bounded)
+                    b->setAxisAligned(lo, hi);
+                batchObject.push_back(b);
+                batchGraphic.push_back(batch);
+                for (unsigned k = i; k < j; k++)
+                    merged[member[k]] = 1;
+            }
+        }
+    }
+}
+
+// classify classifies the objects one generation at a time - parents before
+// their children - so that a child that lies within its parent's bounding 
+// sphere inherits the containment of a parent that is wholly inside or
+// wholly outside the frustum without being tested itself
+//
+#define UNCLASSIFIED 0xFF
+
+void Coordinator::classify() {
+
+    unsigned n = object.size();
+    bool     pending = true;
+
+    for (unsigned s = 0; s < n; s++)
+        clip[s] = object[s] ? UNCLASSIFIED : CULL_OUTSIDE;
+
+    while (pending) {
+        pending = false;
+        batch.clear();
+        for (unsigned s = 0; s < n; s++) {
+            if (clip[s] != UNCLASSIFIED)
+                continue;
+            int p = parent[s];
+            if (p >= 0 && clip[p] == UNCLASSIFIED)
+                // wait until the parent has been classified
+                pending = true;
+            else if (!radius[s])
+                // no finite boundary - always drawn
+                clip[s] = CULL_PARTIAL;
+            else if (p >= 0 && clip[p] != CULL_PARTIAL && radius[p] &&
+             (centre[s] - centre[p]).length() + radius[s] <= radius[p])
+                // enclosed by a parent that is wholly inside or outside
+                clip[s] = clip[p];
+            else
+                batch.push_back(s);
+        }
+
+        // classify the current generation four spheres at a time
+        unsigned nb = batch.size();
+        if (nb) {
+            bx.resize(nb);
+            by.resize(nb);
+            bz.resize(nb);
+            br.resize(nb);
+            bc.resize(nb);
+            for (unsigned i = 0; i < nb; i++) {
+                bx[i] = centre[batch[i]].x;
+                by[i] = centre[batch[i]].y;
+                bz[i] = centre[batch[i]].z;
+                br[i] = radius[batch[i]];
+            }
+            frustum.classify(&bx[0], &by[0], &bz[0], &br[0], nb, &bc[0]);
+            for (unsigned i = 0; i < nb; i++)
+                clip[batch[i]] = bc[i];
+        }
+        // parent cycles cannot be resolved - draw the objects involved
+        else if (pending) {
+            for (unsigned s = 0; s < n; s++)
+                if (clip[s] == UNCLASSIFIED)
+                    clip[s] = CULL_PARTIAL;
+            pending = false;
+        }
+    }
+}
+
+// render draws a single object (*object) using world transformation w
+//
+void Coordinator::render(iObject* object, const Matrix& w) {
+
+    display->setWorld(&w);
+    iTexture* texture = object->getTexture();
+    if (texture) texture->attach();
+    const void* reflectivity = object->getReflectivity();
+    if (reflectivity)
+        display->setReflectivity(reflectivity);
+    else
+        display->set(LIGHTING, false);
+    object->render();
+    if (!reflectivity)
+        display->set(LIGHTING, true);
+    if (texture) texture->detach();
+}
+
+// resize resizes the window and the user interface
+//
+void Coordinator::resize() {
+
+    if (active && window->getWindowMode()) {
+        window->resize();
+        projection = ::projection(fov, window->aspectRatio(), nearcp, farcp);
+        display->setProjection(&projection);
+    }
+}
+
+// startPrewarm starts a pass that creates the API resources of the design
+// items ahead of their first use
+//
+void Coordinator::startPrewarm() {
+
+    prewarming   = true;
+    nextPrewarm  = 0;
+    prewarmed    = 0;
+    prewarmUnits = 0;
+}
+
+// prewarm continues the prewarming pass - creates the vertex buffers of the
+// graphics and the textures attached to the objects until every item has
+// been visited or the frame's budget has been spent - items that are drawn
+// before the pass reaches them create their resources as they did before
+//
+void Coordinator::prewarm() {
+
+    unsigned start  = window->time();
+    unsigned budget = PREWARM_BUDGET * unitsPerSec / 1000;
+    unsigned nGraphics = graphic.size(), n = nGraphics + object.size();
+
+    while (nextPrewarm < n && window->time() - start <= budget) {
+        unsigned i = nextPrewarm++;
+        if (i < nGraphics) {
+            if (graphic[i] && graphic[i]->prepare())
+                prewarmed++;
+        }
+        else if (object[i - nGraphics]) {
+            iTexture* t = object[i - nGraphics]->getTexture();
+            if (t && t->prepare())
+                prewarmed++;
+        }
+    }
+    prewarmUnits += window->time() - start;
+    if (nextPrewarm >= n)
+        prewarming = false;
+}
+
+// noParticles returns the number of live particles in all of the emitters
+//
+unsigned Coordinator::noParticles() const {
+
+    unsigned n = 0;
+    for (unsigned i = 0; i < emitter.size(); i++)
+        if (emitter[i])
+            n += emitter[i]->noParticles();
+
+    return n;
+}
+
+// noStreamedBytes returns the number of bytes of vertices that the dynamic
+// vertex lists streamed to the display in the last frame
+//
+unsigned Coordinator::noStreamedBytes() const {
+
+    return display->noStreamedBytes();
+}
+
+// prewarmTime returns the time in milliseconds that the current or most
+// recent prewarming pass has spent creating resources
+//
+unsigned Coordinator::prewarmTime() const {
+
+    return (unsigned)(prewarmUnits * 1000.0 / unitsPerSec);
+}
+
+// restoreTime returns the time in milliseconds that the most recent restore
+// or reset took - the resources that it did not rebuild are created by the
+// prewarming pass that follows
+//
+unsigned Coordinator::restoreTime() const {
+
+    return (unsigned)(restoreUnits * 1000.0 / unitsPerSec);
+}
+
+// suspend suspends all of the design items
+//
+void Coordinator::suspend() {
+
+	for (unsigned i = 0; i < texture.size(); i++)
+		if (texture[i])
+			texture[i]->suspend();
+
+	for (unsigned i = 0; i < light.size(); i++)
+		if (light[i])
+			light[i]->suspend();
+
+    for (unsigned i = 0; i < sound.size(); i++)
+		if (sound[i]) 
+			sound[i]->suspend();
+
+    for (unsigned i = 0; i < graphic.size(); i++)
+		if (graphic[i]) 
+			graphic[i]->suspend();
+
+    for (unsigned i = 0; i < text.size(); i++)
+        if (text[i])
+			text[i]->suspend();
+
+    for (unsigned i = 0; i < emitter.size(); i++)
+        if (emitter[i])
+			emitter[i]->suspend();
+
+    display->suspend();
+    userInput->suspend();
+    audio->suspend();
+    active = false;
+}
+
+// restore restores all of the design items and initializes the timers
+//
+void Coordinator::restore() {
+
+    unsigned start = window->time();
+    now = start;
+    userInput->restore();
+    display->restore();
+    projection = ::projection(fov, window->aspectRatio(), nearcp, farcp);
+    display->setProjection(&projection);
+    audio->restore();
+
+    for (unsigned i = 0; i < camera.size(); i++)
+        if (camera[i])
+			camera[i]->restore();
+	for (unsigned i = 0; i < light.size(); i++)
+		if (light[i])
+			light[i]->restore();
+	for (unsigned i = 0; i < sound.size(); i++)
+		if (sound[i]) 
+			sound[i]->restore();
+    for (unsigned i = 0; i < hud.size(); i++)
+        if (hud[i])
+			hud[i]->restore();
+    for (unsigned i = 0; i < text.size(); i++)
+        if (text[i])
+			text[i]->restore();
+
+    lastCameraToggle = now;
+    lastHUDToggle    = now;
+    lastUpdate       = now;
+    active           = true;
+    restoreUnits     = window->time() - start;
+    startPrewarm();
+}
+
+// release releases the design items
+//
+void Coordinator::release() {
+
+	for (unsigned i = 0; i < texture.size(); i++)
+		if (texture[i])
+			texture[i]->release();
+
+    for (unsigned i = 0; i < graphic.size(); i++)
+		if (graphic[i]) 
+			graphic[i]->release();
+
+    for (unsigned i = 0; i < text.size(); i++)
+        if (text[i])
+			text[i]->release();
+
+    for (unsigned i = 0; i < emitter.size(); i++)
+        if (emitter[i])
+			emitter[i]->release();
+
+    for (unsigned i = 0; i < sound.size(); i++)
+        if (sound[i])
+			sound[i]->release();
+
+    display->release();
+    userInput->release();
+    audio->release();
+    window->release();
+}
+
+// destructor deletes all of the coordinator elements
+//
+Coordinator::~Coordinator() {
+
+    // stop the asset workers before deleting the items that they load
+    loader->release();
+
+    for (unsigned i = 0; i < object.size(); i++)
+        if (object[i]) 
+            object[i]->Delete();
+
+    for (unsigned i = 0; i < emitter.size(); i++)
+        if (emitter[i])
+            emitter[i]->Delete();
+
+    for (unsigned i = 0; i < animation.size(); i++)
+        if (animation[i])
+            animation[i]->Delete();
+
+    for (unsigned i = 0; i < texture.size(); i++)
+        if (texture[i]) 
+            texture[i]->Delete();
+
+    for (unsigned i = 0; i < light.size(); i++)
+        if (light[i])
+            light[i]->Delete();
+
+    for (unsigned i = 0; i < camera.size(); i++)
+        if (camera[i])
+            camera[i]->Delete();
+
+    for (unsigned i = 0; i < sound.size(); i++)
+        if (sound[i])
+            sound[i]->Delete();
+
+    for (unsigned i = 0; i < graphic.size(); i++)
+        if (graphic[i])
+            graphic[i]->Delete();
+
+    for (unsigned i = 0; i < text.size(); i++)
+        if (text[i]) 
+			text[i]->Delete();
+
+    display->Delete();
+    userInput->Delete();
+    audio->Delete();
+	window->Delete();
+    loader->Delete();
+
+    loader      = nullptr;
+    coordinator = nullptr;
+}
+
@@ -1,152 +1,223 @@
-#ifndef _COORDINATOR_H_
-#define _COORDINATOR_H_
-
-/* Coordinator Definition - Modelling Layer
- *
- * Coordinator.h
- * fwk4gps version 3.0
- * gam666/dps901/gam670/dps905
- * January 14 2012
- * copyright (c) 2012 Chris Szalwinski 
- * distributed under TPL - see ../Licenses.txt
- */
-
-#include <vector>
-#include "iCoordinator.h"     // for the Coordinator Interface
-#include "MathDeclarations.h" // for Matrix
-
-//-------------------------------- Templates for add and remove ---------------
-//
-// add adds a pointer to *o in vector v
-//
-template <class T>
-void add(std::vector<T>& v, T o) {
-    unsigned i;
-    bool rc = false;
-    
-    for (i = 0; i < v.size() && !rc; i++)
-        if (!v[i]) {
-            v[i] = o;
-            rc = true;
-        }
-    if (!rc)
-        v.push_back(o);
-}
-
-// remove removes the pointer to *o from vector v
-//
-template <class T>
-bool remove(std::vector<T>& v, T o) {
-    bool rc = false;
-
-    for (unsigned i = 0; i < v.size(); i++)
-        if (v[i] == o) {
-            v[i] = 0;
-            rc = true;
-        }
-    while (v.size() && !v[v.size() - 1])
-        v.pop_back();
-
-    return rc;
-}
-
-//-------------------------------- Coordinator --------------------------------
-//
-// The Coordinator class coordinates all design elements in the Modelling Layer 
-//
-enum Category;
-class iAPIWindow;
-class iAPIUserInput;
-class iAPIDisplay;
-class iAPIAudio;
-
-class Coordinator : public iCoordinator {
-
-    iAPIWindow*            window;           // points to the window object
-    iAPIUserInput*         userInput;        // points to the user input object
-    iAPIDisplay*           display;          // points to the display object
-    iAPIAudio*             audio;            // points to the audio object
-
-    std::vector<iObject*>  object;           // points to objects
-	std::vector<iTexture*> texture;          // points to textures
-    std::vector<iLight*>   light;            // points to light sources
-    std::vector<iCamera*>  camera;           // points to cameras
-    std::vector<iSound*>   sound;            // points to sound sources
-    std::vector<iGraphic*> graphic;          // points to graphics
-    std::vector<iText*>    text;             // points to text items
-    std::vector<iHUD*>     hud;              // points to huds
-
-    unsigned               framecount;       // no of frames since 'lastReset'
-    unsigned               fps;              // frame rate per sec
-    unsigned               lastReset;        // last time framecount reset to 0
-
-    unsigned               currentCam;       // index - current camera
-    unsigned               lastCameraToggle; // time of most recent cam toggle
-    unsigned               currentHUD;       // index - current HUD
-    unsigned               lastHUDToggle;    // time of most recent hud toggle
-
-    iTexture*              background;       // points to background texture
-    iText*                 timerText;        // points to timer's text object
-
-    // display device
-    float                  nearcp;           // near clipping plane
-    float                  farcp;            // far clipping plane
-    float                  fov;              // field of view in radians
-    Colour                 ambient;          // background lighting
-
-    Coordinator(const Coordinator& s);            // prevents copying
-    Coordinator& operator=(const Coordinator& s); // prevents assignment
-    bool getConfiguration();
-    void adjustVolume(int);
-    void adjustFrequency(int);
-	void update();
-    void render();
-    void render(iObject*);
-    void render(Category category);
-
-  protected:
-	// configuration
-    void initialize()                 { }
-    void setProjection(float, float, float);
-    void setAmbientLight(float, float, float);
-    void setTimerText(void* text)     { timerText = (iText*)text; }
-    void setBackground(void* texture) { background = (iTexture*)texture; }
- 	// execution
-    bool pressed(Action a) const;
-    bool ptrPressed() const;
-    bool ctrPressed() const;
-    int  change(Action a) const;
-    const wchar_t* soundFile (ModelSound s) const;
-    virtual ~Coordinator();
-
-  public:
-    static iCoordinator* Address() { return coordinator; }
-    Coordinator(void*, int);
-	// initialization
-    void  add(iObject* o)  { ::add(object, o); }
-    void  add(iTexture* t) { ::add(texture, t); }
-    void  add(iLight* l)   { ::add(light, l); }
-    void  add(iCamera* c)  { ::add(camera, c); }
-    void  add(iSound* s)   { ::add(sound, s); }
-    void  add(iGraphic* g) { ::add(graphic, g); }
-    void  add(iText* t)    { ::add(text, t); }
-    void  add(iHUD* h)     { ::add(hud, h); }
-    void  reset();
-	// execution
-    int   run();
-    void  resize();
-    // termination
-    void  suspend();
-	void  restore();
-    void  release();
-    void  remove(iObject* o)  { ::remove(object, o); }
-    void  remove(iTexture* t) { ::remove(texture, t); }
-    void  remove(iLight* l)   { ::remove(light, l); }
-    void  remove(iCamera* c)  { ::remove(camera, c); }
-    void  remove(iSound* s)   { ::remove(sound, s); }
-    void  remove(iGraphic* g) { ::remove(graphic, g); }
-    void  remove(iText* t)    { ::remove(text, t); }
-    void  remove(iHUD* h)     { ::remove(hud, h); }
-};
-
-#endif
+#ifndef _COORDINATOR_H_
+#define _COORDINATOR_H_
+
+/* Coordinator Definition - Modelling Layer
+ *
+ * Coordinator.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <vector>
+#include <utility>           // for pair
+#include <unordered_map>     // for unordered_map
+#include "iCoordinator.h"     // for the Coordinator Interface
+#include "MathDeclarations.h" // for Matrix
+#include "ModellingLayer.h"   // for Category, OBJECT_CATEGORIES
+#include "Frustum.h"          // for the Frustum class definition
+#include "RenderQueue.h"      // for the RenderQueue class definition
+
+//-------------------------------- Templates for add and remove ---------------
+//
+// add adds a pointer to *o in vector v
+//
+template <class T>
+void add(std::vector<T>& v, T o) {
+    unsigned i;
+    bool rc = false;
+    
+    for (i = 0; i < v.size() && !rc; i++)
+        if (!v[i]) {
+            v[i] = o;
+            rc = true;
+        }
+    if (!rc)
+        v.push_back(o);
+}
+
+// remove removes the pointer to *o from vector v
+//
+template <class T>
+bool remove(std::vector<T>& v, T o) {
+    bool rc = false;
+
+    for (unsigned i = 0; i < v.size(); i++)
+        if (v[i] == o) {
+            v[i] = 0;
+            rc = true;
+        }
+    while (v.size() && !v[v.size() - 1])
+        v.pop_back();
+
+    return rc;
+}
+
+//-------------------------------- Coordinator --------------------------------
+//
+// The Coordinator class coordinates all design elements in the Modelling Layer 
+//
+class iFrame;
+class iAPIWindow;
+class iAPIUserInput;
+class iAPIDisplay;
+class iAPIAudio;
+
+class Coordinator : public iCoordinator {
+
+    iAPIWindow*            window;           // points to the window object
+    iAPIUserInput*         userInput;        // points to the user input object
+    iAPIDisplay*           display;          // points to the display object
+    iAPIAudio*             audio;            // points to the audio object
+
+    std::vector<iObject*>  object;           // points to objects
+	std::vector<iTexture*> texture;          // points to textures
+    std::vector<iLight*>   light;            // points to light sources
+    std::vector<iCamera*>  camera;           // points to cameras
+    std::vector<iSound*>   sound;            // points to sound sources
+    std::vector<iGraphic*> graphic;          // points to graphics
+    std::vector<iText*>    text;             // points to text items
+    std::vector<iHUD*>     hud;              // points to huds
+    std::vector<iEmitter*> emitter;          // points to particle emitters
+    std::vector<iAnimation*> animation;      // points to animations
+
+    // slots in object of the objects that belong to each drawing category
+    std::vector<unsigned>  bucket[OBJECT_CATEGORIES];
+    // position + 1 of each slot in each bucket - 0 if not in the bucket
+    std::vector<unsigned>  place[OBJECT_CATEGORIES];
+    std::unordered_map<const iObject*, unsigned> slots; // slot of each object
+    std::vector<unsigned>  freeSlot;         // empty slots in object
+
+    // view frustum culling - per frame data indexed by slot in object
+    Frustum                    frustum;   // view frustum for this frame
+    std::vector<Matrix>        transform; // world transformation
+    std::vector<Vector>        centre;    // centre of bounding sphere
+    std::vector<float>         radius;    // radius of bounding sphere
+    std::vector<int>           parent;    // slot of parent object or -1
+    std::vector<unsigned char> clip;      // Containment wrt frustum
+    std::vector<std::pair<const iFrame*, unsigned> > frameSlot;
+    std::vector<unsigned>      batch;     // slots classified together
+    std::vector<float>         bx, by, bz, br; // batch spheres
+    std::vector<unsigned char> bc;        // batch containments
+    // level of detail - objects with more than one level in view
+    std::vector<unsigned>      lod;       // slots of the objects
+    std::vector<float>         lodDistance; // distances from the camera
+    // static batching - indexed by slot in object
+    std::vector<iObject*>      baked;      // static object when last baked
+    std::vector<Matrix>        bakedWorld; // its world transformation
+    std::vector<unsigned char> merged;     // drawn as part of a batch?
+    std::vector<iObject*>      batchObject;  // objects that draw the batches
+    std::vector<iGraphic*>     batchGraphic; // merged vertex lists
+
+    RenderQueue                queue;     // sorted draw items
+    std::vector<Matrix>        instance;  // world transformations of a group
+    unsigned                   drawn;     // objects drawn in this frame
+    unsigned                   culled;    // objects culled in this frame
+
+    // prewarming - API resources created ahead of their first use
+    bool                       prewarming;   // pass in progress?
+    unsigned                   nextPrewarm;  // next item in the pass
+    unsigned                   prewarmed;    // resources created by the pass
+    unsigned                   prewarmUnits; // system time spent creating
+    unsigned                   restoreUnits; // system time of the last
+                                             // restore or reset
+
+    unsigned               framecount;       // no of frames since 'lastReset'
+    unsigned               fps;              // frame rate per sec
+    unsigned               lastReset;        // last time framecount reset to 0
+
+    unsigned               currentCam;       // index - current camera
+    unsigned               lastCameraToggle; // time of most recent cam toggle
+    unsigned               currentHUD;       // index - current HUD
+    unsigned               lastHUDToggle;    // time of most recent hud toggle
+
+    iTexture*              background;       // points to background texture
+    iText*                 timerText;        // points to timer's text object
+
+    // display device
+    float                  nearcp;           // near clipping plane
+    float                  farcp;            // far clipping plane
+    float                  fov;              // field of view in radians
+    Colour                 ambient;          // background lighting
+    Matrix                 projection;       // projection transformation
+
+    Coordinator(const Coordinator& s);            // prevents copying
+    Coordinator& operator=(const Coordinator& s); // prevents assignment
+    bool getConfiguration();
+    void adjustVolume(int);
+    void adjustFrequency(int);
+	void update();
+    void render();
+    void render(iObject*, const Matrix&);
+    void render(Category category);
+    void submit();
+    void cull();
+    void startPrewarm();
+    void prewarm();
+    bool staticChanged() const;
+    void bake();
+    void classify();
+    void selectLODs();
+    unsigned slot(const iObject*) const;
+    void unfile(int c, unsigned s);
+
+  protected:
+	// configuration
+    void initialize()                 { }
+    void setProjection(float, float, float);
+    void setAmbientLight(float, float, float);
+    void setTimerText(void* text)     { timerText = (iText*)text; }
+    void setBackground(void* texture) { background = (iTexture*)texture; }
+ 	// execution
+    bool pressed(Action a) const;
+    bool ptrPressed() const;
+    bool ctrPressed() const;
+    int  change(Action a) const;
+    const wchar_t* soundFile (ModelSound s) const;
+    virtual ~Coordinator();
+
+  public:
+    static iCoordinator* Address() { return coordinator; }
+    Coordinator(void*, int);
+	// initialization
+    void  add(iObject* o);
+    void  add(iTexture* t) { ::add(texture, t); }
+    void  add(iLight* l)   { ::add(light, l); }
+    void  add(iCamera* c)  { ::add(camera, c); }
+    void  add(iSound* s)   { ::add(sound, s); }
+    void  add(iGraphic* g) { ::add(graphic, g); }
+    void  add(iText* t)    { ::add(text, t); }
+    void  add(iHUD* h)     { ::add(hud, h); }
+    void  add(iEmitter* e) { ::add(emitter, e); }
+    void  add(iAnimation* a) { ::add(animation, a); }
+    void  reset();
+	// execution
+    void  categorize(iObject* o);
+    unsigned noDrawn() const  { return drawn; }
+    unsigned noCulled() const { return culled; }
+    unsigned noParticles() const;
+    unsigned noStreamedBytes() const;
+    unsigned noPrewarmed() const { return prewarmed; }
+    unsigned prewarmTime() const;
+    unsigned restoreTime() const;
+    int   run();
+    void  resize();
+    // termination
+    void  suspend();
+	void  restore();
+    void  release();
+    void  remove(iObject* o);
+    void  remove(iTexture* t) { ::remove(texture, t); }
+    void  remove(iLight* l)   { ::remove(light, l); }
+    void  remove(iCamera* c)  { ::remove(camera, c); }
+    void  remove(iSound* s)   { ::remove(sound, s); }
+    void  remove(iGraphic* g) { ::remove(graphic, g); }
+    void  remove(iText* t)    { ::remove(text, t); }
+    void  remove(iHUD* h)     { ::remove(hud, h); }
+    void  remove(iEmitter* e) { ::remove(emitter, e); }
+    void  remove(iAnimation* a) { ::remove(animation, a); }
+};
+
+#endif
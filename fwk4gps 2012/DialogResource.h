@@ -1,33 +1,33 @@
-#ifndef _DIALOG_H_
-#define _DIALOG_H_
-
-/* Header for the Dialog Resource
- *
- * DialogResource.h
- * fwk4gps version 3.0
- * gam666/dps901/gam670/dps905
- * January 14 2012
- * copyright (c) 2012 Chris Szalwinski 
- * distributed under TPL - see ../Licenses.txt
- */
-
-#include "GeneralConstants.h" // for WND_CAPTION, Z_AXIS
-
-// shared with dialog resource (follows windows conventions)
-//
-#define IDD_DLG 101
-#define IDC_DIS 102
-#define IDC_RES 103
-#define IDC_GO  104
-#define IDC_KEY 105
-#define IDC_ACT 106
-#define IDC_CNT 107
-#define IDC_TRG 108
-#define IDC_YRV 109
-#define IDC_ZON 110
-#define IDC_AUD 111
-#define IDC_SFL 112
-#define IDC_PTO 113
-#define IDC_CTO 114
-
-#endif
+#ifndef _DIALOG_H_
+#define _DIALOG_H_
+
+/* Header for the Dialog Resource
+ *
+ * DialogResource.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "GeneralConstants.h" // for WND_CAPTION, Z_AXIS
+
+// shared with dialog resource (follows windows conventions)
+//
+#define IDD_DLG 101
+#define IDC_DIS 102
+#define IDC_RES 103
+#define IDC_GO  104
+#define IDC_KEY 105
+#define IDC_ACT 106
+#define IDC_CNT 107
+#define IDC_TRG 108
+#define IDC_YRV 109
+#define IDC_ZON 110
+#define IDC_AUD 111
+#define IDC_SFL 112
+#define IDC_PTO 113
+#define IDC_CTO 114
+
+#endif
@@ -0,0 +1,139 @@
+#ifndef _DYNAMIC_VERTEX_LIST_H_
+#define _DYNAMIC_VERTEX_LIST_H_
+
+/* DynamicVertexList Definition - Modelling Layer
+ *
+ * DynamicVertexList.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <cstring>               // for memcpy
+#include "Graphic.h"             // for Graphic class definition
+#include "iAPIGraphic.h"         // for the APIGraphic Interface
+
+//-------------------------------- DynamicVertexList --------------------------
+//
+// The DynamicVertexList class defines the structure of a set of <T> 
+// vertices that are rebuilt every frame - debug lines, hud quads or a
+// deformed mesh - the caller clears the list and adds or writes the
+// vertices of the frame before it is drawn and each draw streams them 
+// through the Translation's shared vertex ring instead of a buffer of 
+// their own
+//
+template <class T = Vertex>
+class DynamicVertexList : public Graphic {
+
+    unsigned      maxNo;         // maximum number of vertices
+    unsigned      no;            // number of vertices stored
+    T*            vertex;        // points to the array of vertices
+    PrimitiveType type;          // type of primitive
+    iAPIGraphic*  api;           // points to the API Primitive Set
+
+    DynamicVertexList(const DynamicVertexList&);
+    DynamicVertexList& operator=(const DynamicVertexList&);
+    virtual ~DynamicVertexList()              { api->Delete(); delete [] vertex; }
+
+  public:
+    DynamicVertexList(PrimitiveType, int);
+    void   clear()                            { no = 0; }
+    int    add(const T& v)                    { if (no < maxNo) vertex[no++] = v; return no; }
+    T*     reserve(unsigned n);
+    void   upload(void* pv, unsigned n) const { memcpy(pv, vertex, n * sizeof(T)); }
+    Vector position(int i) const              { return vertex[i].position(); }
+    float  bounds(Vector& min, Vector& max, Vector& c) const;
+    unsigned noIndices() const                { return 0; }
+    unsigned index(unsigned i) const          { return i; }
+    bool   prepare()                          { return api->prepare(no); }
+    void   render()                           { api->draw(no); }
+    void   render(const Matrix* w, unsigned n){ api->draw(no, w, n); }
+    unsigned  noPrimitives() const;
+    unsigned  batchKey() const                { return 0; }
+    iGraphic* merge(iGraphic* const*, const Matrix*, unsigned) const {
+        return nullptr;
+    }
+    iGraphic* simplify(float) const           { return nullptr; }
+    void   suspend()                          { api->suspend(); }
+    void   release()                          { api->release(); }
+    void   Delete() const                     { delete this; }
+};
+
+// CreateDynamicVertexList creates a Dynamic Vertex List object that holds
+// up to np primitives
+//
+template <class T>
+iGraphic* CreateDynamicVertexList(PrimitiveType t, int np) {
+
+    return new DynamicVertexList<T>(t, np);
+}
+
+// constructor allocates memory for the list and creates the Translation
+//
+template <class T>
+DynamicVertexList<T>::DynamicVertexList(PrimitiveType t, int np) : no(0), 
+ type(t) {
+
+    if (np <= 0)
+        maxNo = 0;
+    else {
+        // Determine the number of vertices for the Primitive Type
+        switch (t) {
+            case POINT_LIST:     maxNo = np;     break;
+            case LINE_LIST:      maxNo = 2 * np; break;
+            case LINE_STRIP:     maxNo = np + 1; break;
+            case TRIANGLE_LIST:  maxNo = 3 * np; break;
+            case TRIANGLE_STRIP: maxNo = np + 2; break;
+            case TRIANGLE_FAN:   maxNo = np + 1; break;
+            default: maxNo = np;
+        }
+    }
+
+    vertex = maxNo ? new T[maxNo] : 0;
+    api    = CreateAPIDynamicList(t, T::vertexSize(), T::vertexFormat(), 
+     (iGraphic*)this);
+}
+
+// reserve appends n vertices to the list for the caller to write directly
+// - returns the address of the first of them or nullptr if the list cannot
+// hold them
+//
+template <class T>
+T* DynamicVertexList<T>::reserve(unsigned n) {
+
+    if (n > maxNo - no) return nullptr;
+    no += n;
+
+    return vertex + no - n;
+}
+
+// bounds reports no finite bounds - the vertices change every frame, so an
+// object that draws the list is never culled
+//
+template <class T>
+float DynamicVertexList<T>::bounds(Vector& min, Vector& max, Vector& c) const {
+
+    min = max = c = Vector();
+
+    return 0;
+}
+
+// noPrimitives returns the number of primitives drawn by the vertices 
+// stored
+//
+template <class T>
+unsigned DynamicVertexList<T>::noPrimitives() const {
+
+    switch (type) {
+        case LINE_LIST:      return no / 2;
+        case LINE_STRIP:     return no > 1 ? no - 1 : 0;
+        case TRIANGLE_LIST:  return no / 3;
+        case TRIANGLE_STRIP:
+        case TRIANGLE_FAN:   return no > 2 ? no - 2 : 0;
+        default:             return no;
+    }
+}
+
+#endif
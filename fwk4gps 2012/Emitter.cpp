@@ -0,0 +1,381 @@
+/* Emitter Implementation - Modelling Layer
+ *
+ * Emitter.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "Emitter.h"         // for the Emitter class definition
+#include "Graphic.h"         // for the Graphic and SpriteVertex classes
+#include "iCoordinator.h"    // for the Coordinator Interface
+#include "iAPIGraphic.h"     // for the APIGraphic Interface
+#include "Camera.h"          // for Camera::getCurrent()
+#include "MathDefinitions.h" // for math functions in model coordinates
+#include "ModellingLayer.h"  // for PARTICLE_SLICE
+#include "Common_Symbols.h"  // for MODEL_Z_AXIS
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE__)
+#define PARTICLE_SSE
+#include <xmmintrin.h>       // for the SSE intrinsics
+#endif
+
+// particles is the task that integrates particles first to last of
+// emitter e or, if vertex is not nullptr, expands them into vertex
+//
+static void particles(void* e, unsigned first, unsigned last, void* vertex) {
+
+    if (vertex)
+        ((const Emitter*)e)->expand(first, last, vertex);
+    else
+        ((Emitter*)e)->integrate(first, last);
+}
+
+//-------------------------------- ParticleStream -----------------------------
+//
+// The ParticleStream class is the vertex list that streams the quads of an
+// Emitter - it holds no vertices of its own and has the Emitter write them
+// straight into the vertex buffer
+//
+class ParticleStream : public Graphic {
+
+    const Emitter* emitter;    // points to the emitter that owns the stream
+    iAPIGraphic*   apiGraphic; // points to the api quad list
+
+    ParticleStream(const ParticleStream&);
+    ParticleStream& operator=(const ParticleStream&);
+    virtual ~ParticleStream() { if (apiGraphic) apiGraphic->Delete(); }
+
+  public:
+    ParticleStream(const Emitter* e) : emitter(e) {
+        apiGraphic = CreateAPIQuadList(SpriteVertex::vertexSize(), 
+         SpriteVertex::vertexFormat(), this);
+    }
+    void   upload(void* pv, unsigned n) const { emitter->upload(pv, n); }
+    bool   prepare()                          { return false; }
+    Vector position(int) const                { return Vector(); }
+    float  bounds(Vector& min, Vector& max, Vector& c) const {
+        min = max = c = Vector();
+        return 0;
+    }
+    unsigned noIndices() const                { return 0; }
+    unsigned index(unsigned) const            { return 0; }
+    void   render() { apiGraphic->draw(4 * emitter->noParticles()); }
+    void   render(const Matrix*, unsigned)    { render(); }
+    unsigned  noPrimitives() const { return 2 * emitter->noParticles(); }
+    unsigned  batchKey() const                { return 0; }
+    iGraphic* merge(iGraphic* const*, const Matrix*, unsigned) const {
+        return nullptr;
+    }
+    iGraphic* simplify(float) const           { return nullptr; }
+    void   suspend()                          { apiGraphic->suspend(); }
+    void   release()                          { apiGraphic->release(); }
+};
+
+//-------------------------------- Emitter ------------------------------------
+//
+// The Emitter class spawns, moves and draws a system of particles
+//
+Workers* Emitter::workers  = nullptr;
+unsigned Emitter::emitters = 0;
+
+// CreateEmitter creates an Emitter object that holds up to maxParticles 
+// live particles
+//
+iEmitter* CreateEmitter(unsigned maxParticles) {
+
+    return new Emitter(maxParticles);
+}
+
+// constructor allocates the particle arrays, creates the stream that draws
+// them and attaches the emitter to the shared workers
+//
+Emitter::Emitter(unsigned m) : maxNo(m), no(0), rate(0), lifetime(1), 
+ minSpeed(1), maxSpeed(1), spread(0), drag(0), startSize(1), growth(0), 
+ argb(0xFFFFFFFF), texture(nullptr), owed(0), burst(0), lastStep(now), 
+ dt(0), damp(1) {
+
+    coordinator->add(this);
+
+    x      = new float[maxNo];
+    y      = new float[maxNo];
+    z      = new float[maxNo];
+    vx     = new float[maxNo];
+    vy     = new float[maxNo];
+    vz     = new float[maxNo];
+    life   = new float[maxNo];
+    size   = new float[maxNo];
+    colour = new unsigned[maxNo];
+    seed   = 0x9E3779B9u * (emitters + 1);
+    stream = new ParticleStream(this);
+    coordinator->remove(stream);
+    emitters++;
+    workers = AttachWorkers();
+}
+
+// setSpeed sets the range of initial speeds
+//
+void Emitter::setSpeed(float minimum, float maximum) {
+
+    minSpeed = minimum;
+    maxSpeed = maximum < minimum ? minimum : maximum;
+}
+
+// setAcceleration sets the constant acceleration in model coordinates
+//
+void Emitter::setAcceleration(float ax, float ay, float az) {
+
+    accel = Vector(ax, ay, az * MODEL_Z_AXIS);
+}
+
+// setColour sets the colour of the particles spawned from now on - the
+// alpha fades to 0 over the life of each particle
+//
+void Emitter::setColour(const Colour& c) {
+
+    argb = COLOUR_TO_ARGB(c);
+}
+
+// random returns a pseudo-random number in [0, 1)
+//
+float Emitter::random() {
+
+    seed = seed * 1664525u + 1013904223u;
+
+    return (seed >> 8) * (1.0f / 16777216);
+}
+
+// step sets the length of the current update and the velocity factor that
+// applies the drag over it
+//
+void Emitter::step() {
+
+    float s  = (float)(now - lastStep) / unitsPerSec;
+    lastStep = now;
+    dt       = s > PARTICLE_MAX_STEP ? PARTICLE_MAX_STEP : s;
+    damp     = 1 - drag * dt;
+    if (damp < 0) damp = 0;
+}
+
+// integrate advances particles [first, last) by the current step - the SSE
+// version advances four particles at a time
+//
+void Emitter::integrate(unsigned first, unsigned last) {
+
+    float    dvx = accel.x * dt, dvy = accel.y * dt, dvz = accel.z * dt;
+    float    ds  = growth * dt;
+    unsigned i   = first;
+
+    #ifdef PARTICLE_SSE
+    __m128 t  = _mm_set1_ps(dt);
+    __m128 d  = _mm_set1_ps(damp);
+    __m128 ax = _mm_set1_ps(dvx);
+    __m128 ay = _mm_set1_ps(dvy);
+    __m128 az = _mm_set1_ps(dvz);
+    __m128 g  = _mm_set1_ps(ds);
+    for (; i + 4 <= last; i += 4) {
+        __m128 u = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(vx + i), d), ax);
+        __m128 v = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(vy + i), d), ay);
+        __m128 w = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(vz + i), d), az);
+        _mm_storeu_ps(vx + i, u);
+        _mm_storeu_ps(vy + i, v);
+        _mm_storeu_ps(vz + i, w);
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), 
+         _mm_mul_ps(u, t)));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), 
+         _mm_mul_ps(v, t)));
+        _mm_storeu_ps(z + i, _mm_add_ps(_mm_loadu_ps(z + i), 
+         _mm_mul_ps(w, t)));
+        _mm_storeu_ps(life + i, _mm_sub_ps(_mm_loadu_ps(life + i), t));
+        _mm_storeu_ps(size + i, _mm_add_ps(_mm_loadu_ps(size + i), g));
+    }
+    #endif
+    for (; i < last; i++) {
+        vx[i]    = vx[i] * damp + dvx;
+        vy[i]    = vy[i] * damp + dvy;
+        vz[i]    = vz[i] * damp + dvz;
+        x[i]    += vx[i] * dt;
+        y[i]    += vy[i] * dt;
+        z[i]    += vz[i] * dt;
+        life[i] -= dt;
+        size[i] += ds;
+    }
+}
+
+// compact moves the last live particle into the place of each particle
+// whose life has run out
+//
+void Emitter::compact() {
+
+    unsigned i = 0;
+    while (i < no) {
+        if (life[i] > 0)
+            i++;
+        else {
+            no--;
+            x[i]      = x[no];
+            y[i]      = y[no];
+            z[i]      = z[no];
+            vx[i]     = vx[no];
+            vy[i]     = vy[no];
+            vz[i]     = vz[no];
+            life[i]   = life[no];
+            size[i]   = size[no];
+            colour[i] = colour[no];
+        }
+    }
+}
+
+// spawn adds the particles owed by the spawn rate over the current step
+// and those requested by emit - each leaves the origin of the emitter in a
+// direction chosen uniformly within the cone of half angle spread about
+// the emitter's z axis
+//
+void Emitter::spawn() {
+
+    float    want = owed + rate * dt;
+    unsigned n    = (unsigned)want;
+    owed  = want - n;
+    n    += burst;
+    burst = 0;
+    if (n > maxNo - no) n = maxNo - no;
+    if (!n) return;
+
+    Vector p    = ::position(world());
+    Vector axis = orientation('z');
+    Vector u    = normal(cross(axis, fabs(axis.x) < 0.9f ? Vector(1, 0, 0) :
+     Vector(0, 1, 0)));
+    Vector v    = cross(axis, u);
+    float  c0   = cosf(spread);
+    for (unsigned k = 0; k < n; k++) {
+        float  c     = 1 - random() * (1 - c0);
+        float  s     = sqrtf(1 - c * c);
+        float  phi   = 6.2831853f * random();
+        Vector d     = c * axis + (s * cosf(phi)) * u + (s * sinf(phi)) * v;
+        float  speed = minSpeed + (maxSpeed - minSpeed) * random();
+        x[no]      = p.x;
+        y[no]      = p.y;
+        z[no]      = p.z;
+        vx[no]     = speed * d.x;
+        vy[no]     = speed * d.y;
+        vz[no]     = speed * d.z;
+        life[no]   = lifetime;
+        size[no]   = startSize;
+        colour[no] = argb;
+        no++;
+    }
+}
+
+// expand writes particles [first, last) into vertex as quads that face the
+// camera - the alpha of each quad is scaled by the fraction of its life
+// left
+//
+void Emitter::expand(unsigned first, unsigned last, void* vertex) const {
+
+    SpriteVertex* v = (SpriteVertex*)vertex + 4 * first;
+    float inverse = lifetime > 0 ? 1 / lifetime : 0;
+
+    for (unsigned i = first; i < last; i++, v += 4) {
+        float h  = 0.5f * size[i];
+        float rx = h * right.x, ry = h * right.y, rz = h * right.z;
+        float ux = h * up.x,    uy = h * up.y,    uz = h * up.z;
+        float f  = life[i] * inverse;
+        unsigned a = (unsigned)((colour[i] >> 24) * (f < 1 ? f : 1));
+        unsigned c = a << 24 | (colour[i] & 0xFFFFFF);
+        v[0] = SpriteVertex(x[i] - rx - ux, y[i] - ry - uy, z[i] - rz - uz,
+         c, 0, 1);
+        v[1] = SpriteVertex(x[i] - rx + ux, y[i] - ry + uy, z[i] - rz + uz,
+         c, 0, 0);
+        v[2] = SpriteVertex(x[i] + rx + ux, y[i] + ry + uy, z[i] + rz + uz,
+         c, 1, 0);
+        v[3] = SpriteVertex(x[i] + rx - ux, y[i] + ry - uy, z[i] + rz - uz,
+         c, 1, 1);
+    }
+}
+
+// upload expands the live particles into the n vertices of the locked
+// vertex buffer - large systems expand in slices on the workers
+//
+void Emitter::upload(void* vertex, unsigned n) const {
+
+    std::vector<WorkerTask> task;
+    n /= 4;
+    slice(task, particles, (Emitter*)this, n < no ? n : no, PARTICLE_SLICE,
+     vertex);
+    workers->run(task);
+}
+
+// render draws the live particles as quads facing the current camera -
+// the coordinator sets the identity world transformation beforehand
+//
+void Emitter::render() {
+
+    if (!no) return;
+    const iFrame* camera = *Camera::getCurrent();
+    right = camera ? camera->orientation('x') : Vector(1, 0, 0);
+    up    = camera ? camera->orientation('y') : Vector(0, 1, 0);
+    stream->render();
+}
+
+// suspend suspends the stream - its vertex buffer does not survive a reset
+//
+void Emitter::suspend() {
+
+    stream->suspend();
+}
+
+// release releases the stream's buffers
+//
+void Emitter::release() {
+
+    stream->release();
+}
+
+// destructor deletes the stream and the particle arrays and detaches the
+// emitter from the shared workers
+//
+Emitter::~Emitter() {
+
+    stream->Delete();
+    delete [] x;
+    delete [] y;
+    delete [] z;
+    delete [] vx;
+    delete [] vy;
+    delete [] vz;
+    delete [] life;
+    delete [] size;
+    delete [] colour;
+    if (!--emitters) workers = nullptr;
+    DetachWorkers();
+
+    coordinator->remove(this);
+}
+
+//-------------------------------- UpdateEmitters -----------------------------
+//
+// UpdateEmitters integrates the particles of all n emitters together so 
+// that the slices of every system share the workers, then retires
+// the expired particles and spawns the new ones on the main thread
+//
+void UpdateEmitters(iEmitter* const* e, unsigned n) {
+
+    static std::vector<WorkerTask> task;
+
+    task.clear();
+    for (unsigned i = 0; i < n; i++)
+        if (e[i]) {
+            Emitter* m = (Emitter*)e[i];
+            m->step();
+            slice(task, particles, m, m->no, PARTICLE_SLICE, nullptr);
+        }
+    if (Emitter::workers) Emitter::workers->run(task);
+    for (unsigned i = 0; i < n; i++)
+        if (e[i]) {
+            Emitter* m = (Emitter*)e[i];
+            m->compact();
+            m->spawn();
+        }
+}
@@ -0,0 +1,104 @@
+#ifndef _EMITTER_H_
+#define _EMITTER_H_
+
+/* Emitter Definition - Modelling Layer
+ *
+ * Emitter.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <vector>
+#include "iEmitter.h"         // for the Emitter Interface
+#include "MathDeclarations.h" // for Vector
+#include "Workers.h"          // for the Workers class definition
+
+//-------------------------------- Emitter ------------------------------------
+//
+// The Emitter class spawns particles from the origin of its frame and moves
+// them under constant acceleration and drag until their life runs out - 
+// the particles are stored as separate arrays of each attribute so that 
+// the integration processes four particles at a time and the slices of a 
+// large system update on the particle workers
+//
+// each frame the live particles are expanded into camera-facing quads in
+// world space and streamed through a single dynamic vertex buffer - the
+// Emitter owns the vertex list that streams them and withdraws it from the
+// coordinator
+//
+class iGraphic;
+
+class Emitter : public iEmitter {
+
+    unsigned  maxNo;     // capacity of the particle arrays
+    unsigned  no;        // number of live particles
+    float*    x;         // positions in world space
+    float*    y;
+    float*    z;
+    float*    vx;        // velocities in world space
+    float*    vy;
+    float*    vz;
+    float*    life;      // seconds left to live
+    float*    size;      // width of the quad
+    unsigned* colour;    // colour packed as ARGB
+
+    float     rate;      // particles spawned per second
+    float     lifetime;  // seconds that a particle lives
+    float     minSpeed;  // slowest initial speed
+    float     maxSpeed;  // fastest initial speed
+    float     spread;    // half angle of the cone of initial directions
+    Vector    accel;     // constant acceleration in world space
+    float     drag;      // fraction of velocity lost per second
+    float     startSize; // initial width of the quad
+    float     growth;    // change in width per second
+    unsigned  argb;      // colour of new particles packed as ARGB
+    iTexture* texture;   // points to the texture drawn on each quad
+
+    float     owed;      // fractional particles owed by the spawn rate
+    unsigned  burst;     // particles requested by emit
+    unsigned  seed;      // state of the random number generator
+    unsigned  lastStep;  // time of the last update
+    float     dt;        // length of the current step in seconds
+    float     damp;      // velocity factor of the current step
+    Vector    right;     // camera's right axis for the current draw
+    Vector    up;        // camera's up axis for the current draw
+    iGraphic* stream;    // streams the quads
+
+    static Workers*  workers;  // shared by all emitters
+    static unsigned  emitters; // number of emitters
+
+    Emitter(const Emitter&);
+    Emitter& operator=(const Emitter&);
+    virtual ~Emitter();
+    float random();
+    void  step();
+    void  compact();
+    void  spawn();
+
+  public:
+    Emitter(unsigned maxParticles);
+    void      attach(iTexture* t)        { texture = t; }
+    void      setRate(float r)           { rate = r; }
+    void      setLife(float s)           { lifetime = s; }
+    void      setSpeed(float minimum, float maximum);
+    void      setSpread(float r)         { spread = r; }
+    void      setAcceleration(float x, float y, float z);
+    void      setDrag(float d)           { drag = d; }
+    void      setSize(float s, float g)  { startSize = s; growth = g; }
+    void      setColour(const Colour& c);
+    void      emit(unsigned n)           { burst += n; }
+    unsigned  noParticles() const        { return no; }
+    iTexture* getTexture() const         { return texture; }
+    void      integrate(unsigned first, unsigned last);
+    void      expand(unsigned first, unsigned last, void* vertex) const;
+    void      upload(void* vertex, unsigned n) const;
+    void      render();
+    void      suspend();
+    void      release();
+    friend void UpdateEmitters(iEmitter* const*, unsigned);
+};
+
+#endif
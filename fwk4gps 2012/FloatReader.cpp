@@ -0,0 +1,256 @@
+/* FloatReader Implementation - Modelling Layer
+ *
+ * FloatReader.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <cstring>         // for memmove
+#include "FloatReader.h"   // for the FloatReader class definition
+
+// exact powers of ten representable as doubles
+static const double power10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+ 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19,
+ 1e20, 1e21, 1e22 };
+
+// isSpace identifies the characters that separate numbers
+//
+inline bool isSpace(char c) {
+
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\f' ||
+     c == '\v';
+}
+
+//-------------------------------- parseFloat ---------------------------------
+//
+// parseFloat converts [sign] digits [. digits] [e|E [sign] digits] in
+// [s, e) to a float - keeps the first 19 significant digits in an integer
+// and applies the decimal exponent with exact powers of ten - independent
+// of the locale
+//
+bool parseFloat(const char* s, const char* e, float& f) {
+
+    bool negative = false;
+    if (s < e && (*s == '-' || *s == '+'))
+        negative = *s++ == '-';
+
+    unsigned long long mantissa = 0;
+    int exponent = 0, significant = 0;
+    bool digits = false;
+    for (; s < e && *s >= '0' && *s <= '9'; s++) {
+        digits = true;
+        if (significant < 19) {
+            mantissa = mantissa * 10 + (*s - '0');
+            if (mantissa) significant++;
+        }
+        else
+            exponent++;
+    }
+    if (s < e && *s == '.')
+        for (s++; s < e && *s >= '0' && *s <= '9'; s++) {
+            digits = true;
+            if (significant < 19) {
+                mantissa = mantissa * 10 + (*s - '0');
+                if (mantissa) significant++;
+                exponent--;
+            }
+        }
+    if (!digits) return false;
+
+    if (s < e && (*s == 'e' || *s == 'E')) {
+        bool negativeExponent = false;
+        s++;
+        if (s < e && (*s == '-' || *s == '+'))
+            negativeExponent = *s++ == '-';
+        if (s == e || *s < '0' || *s > '9') return false;
+        int x = 0;
+        for (; s < e && *s >= '0' && *s <= '9'; s++)
+            if (x < 10000) x = x * 10 + (*s - '0');
+        exponent += negativeExponent ? -x : x;
+    }
+    if (s != e) return false;
+
+    double v = (double)mantissa;
+    if (v) {
+        while (exponent > 22) {
+            v *= 1e22;
+            exponent -= 22;
+        }
+        while (exponent < -22) {
+            v /= 1e22;
+            exponent += 22;
+        }
+        if (exponent >= 0)
+            v *= power10[exponent];
+        else
+            v /= power10[-exponent];
+    }
+    f = (float)(negative ? -v : v);
+
+    return true;
+}
+
+//-------------------------------- FloatReader --------------------------------
+//
+// The FloatReader class reads floating-point numbers from a text file
+//
+// constructor opens narrow-named file
+//
+FloatReader::FloatReader(const char* file) : next(buffer), end(buffer),
+ eof(false), bytes(0) {
+
+    #ifdef _MSC_VER
+    if (fopen_s(&fp, file, "rb")) fp = nullptr;
+    #else
+    fp = fopen(file, "rb");
+    #endif
+    open();
+}
+
+// constructor opens wide-named file
+//
+FloatReader::FloatReader(const wchar_t* file) : next(buffer), end(buffer),
+ eof(false), bytes(0) {
+
+    #ifdef _MSC_VER
+    if (_wfopen_s(&fp, file, L"rb")) fp = nullptr;
+    #else
+    char name[FILENAME_MAX];
+    unsigned i;
+    for (i = 0; file[i] && i + 1 < FILENAME_MAX; i++)
+        name[i] = (char)file[i];
+    name[i] = '\0';
+    fp = fopen(name, "rb");
+    #endif
+    open();
+}
+
+// open determines the size of the opened file
+//
+void FloatReader::open() {
+
+    if (fp) {
+        fseek(fp, 0, SEEK_END);
+        long s = ftell(fp);
+        bytes = s > 0 ? (unsigned)s : 0;
+        fseek(fp, 0, SEEK_SET);
+    }
+    else
+        eof = true;
+}
+
+// refill moves the unread characters to the front of the buffer and fills
+// the rest of the buffer from the file - returns false if nothing was added
+//
+bool FloatReader::refill() {
+
+    unsigned left = end - next;
+    if (eof || (next == buffer && left == FLOAT_READER_BLOCK)) return false;
+
+    memmove(buffer, next, left);
+    next = buffer;
+    end  = buffer + left;
+    unsigned n = fread(end, 1, FLOAT_READER_BLOCK - left, fp);
+    end += n;
+    if (n < FLOAT_READER_BLOCK - left)
+        eof = true;
+
+    return n > 0;
+}
+
+// read reads the next number into f - returns false at the end of the file
+// or at a token that is not a number
+//
+bool FloatReader::read(float& f) {
+
+    // skip separators
+    for (;;) {
+        while (next < end && isSpace(*next))
+            next++;
+        if (next < end || !refill())
+            break;
+    }
+    if (next == end) return false;
+
+    // find the end of the token - refill if it runs off the block
+    char* t = next;
+    while (t < end && !isSpace(*t))
+        t++;
+    if (t == end && !eof) {
+        unsigned offset = t - next;
+        refill();
+        t = next + offset;
+        while (t < end && !isSpace(*t))
+            t++;
+        if (t == end && !eof)
+            return false; // token longer than a block
+    }
+
+    bool rc = parseFloat(next, t, f);
+    next = t;
+
+    return rc;
+}
+
+// read reads the next n numbers into f - returns false if fewer than n
+// numbers remain
+//
+bool FloatReader::read(float* f, unsigned n) {
+
+    for (unsigned i = 0; i < n; i++)
+        if (!read(f[i]))
+            return false;
+
+    return true;
+}
+
+// readLine sets [s, e) to the next line without its line terminator - the
+// characters remain valid until the next call - returns false at the end of
+// the file or at a line longer than a block
+//
+bool FloatReader::readLine(const char*& s, const char*& e) {
+
+    if (next == end && !refill()) return false;
+
+    char* t = next;
+    while (t < end && *t != '\n')
+        t++;
+    if (t == end && !eof) {
+        unsigned offset = t - next;
+        refill();
+        t = next + offset;
+        while (t < end && *t != '\n')
+            t++;
+        if (t == end && !eof)
+            return false; // line longer than a block
+    }
+
+    s = next;
+    e = t;
+    next = t < end ? t + 1 : t;
+    if (e > s && e[-1] == '\r') e--;
+
+    return true;
+}
+
+// rewind returns to the start of the file
+//
+void FloatReader::rewind() {
+
+    if (fp) {
+        fseek(fp, 0, SEEK_SET);
+        next = end = buffer;
+        eof  = false;
+    }
+}
+
+// destructor closes the file
+//
+FloatReader::~FloatReader() {
+
+    if (fp)
+        fclose(fp);
+}
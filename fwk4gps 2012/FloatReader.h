@@ -0,0 +1,54 @@
+#ifndef _FLOAT_READER_H_
+#define _FLOAT_READER_H_
+
+/* FloatReader Definition - Modelling Layer
+ *
+ * FloatReader.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <cstdio> // for FILE
+
+#define FLOAT_READER_BLOCK 65536 // bytes read from the file at a time
+
+//-------------------------------- FloatReader --------------------------------
+//
+// The FloatReader class reads whitespace-separated floating-point numbers
+// or whole lines from a text file in large blocks and converts numbers
+// without reference to the locale - it allocates nothing after construction
+//
+class FloatReader {
+
+    FILE*    fp;                             // file being read
+    char     buffer[FLOAT_READER_BLOCK];     // current block
+    char*    next;                           // next unread character
+    char*    end;                            // one past the last character
+    bool     eof;                            // end of file reached
+    unsigned bytes;                          // size of the file
+
+    FloatReader(const FloatReader&);
+    FloatReader& operator=(const FloatReader&);
+    void open();
+    bool refill();
+
+  public:
+    FloatReader(const char* file);
+    FloatReader(const wchar_t* file);
+    ~FloatReader();
+    bool     isOpen() const { return fp != nullptr; }
+    unsigned size() const   { return bytes; }
+    bool     read(float& f);
+    bool     read(float* f, unsigned n);
+    bool     readLine(const char*& s, const char*& e);
+    void     rewind();
+};
+
+// parseFloat converts the characters in [s, e) to a float - returns false
+// if they do not form a complete number
+bool parseFloat(const char* s, const char* e, float& f);
+
+#endif
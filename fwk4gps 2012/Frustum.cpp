@@ -0,0 +1,118 @@
+/* Frustum Implementation - Modelling Layer
+ *
+ * Frustum.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "Frustum.h"         // for the Frustum class definition
+#include "MathDefinitions.h" // for sqrtf, dot
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE__)
+#define FRUSTUM_SSE
+#include <xmmintrin.h>       // for the SSE intrinsics
+#endif
+
+//-------------------------------- Frustum ------------------------------------
+//
+// The Frustum class holds the six planes of the view volume in world space
+//
+// extract extracts the planes from the combined view-projection
+// transformation - a point p lies inside the volume if p * m lands inside
+// the clipping volume: -w <= x <= w, -w <= y <= w, 0 <= z <= w
+//
+void Frustum::extract(const Matrix& m) {
+
+    // left, right
+    plane[0] = Plane(Vector(m.m14 + m.m11, m.m24 + m.m21, m.m34 + m.m31),
+     m.m44 + m.m41);
+    plane[1] = Plane(Vector(m.m14 - m.m11, m.m24 - m.m21, m.m34 - m.m31),
+     m.m44 - m.m41);
+    // bottom, top
+    plane[2] = Plane(Vector(m.m14 + m.m12, m.m24 + m.m22, m.m34 + m.m32),
+     m.m44 + m.m42);
+    plane[3] = Plane(Vector(m.m14 - m.m12, m.m24 - m.m22, m.m34 - m.m32),
+     m.m44 - m.m42);
+    // near, far
+    plane[4] = Plane(Vector(m.m13, m.m23, m.m33), m.m43);
+    plane[5] = Plane(Vector(m.m14 - m.m13, m.m24 - m.m23, m.m34 - m.m33),
+     m.m44 - m.m43);
+
+    // normalize so that signed distances are in world units
+    for (int i = 0; i < 6; i++) {
+        float len = plane[i].n.length();
+        if (len) {
+            plane[i].n = plane[i].n / len;
+            plane[i].d = plane[i].d / len;
+        }
+    }
+}
+
+// classify returns the containment of the sphere of radius r centred at c
+// - stops at the first plane that the sphere lies wholly behind
+//
+Containment Frustum::classify(const Vector& c, float r) const {
+
+    Containment rc = CULL_INSIDE;
+
+    for (int i = 0; i < 6 && rc != CULL_OUTSIDE; i++) {
+        float d = dot(plane[i].n, c) + plane[i].d;
+        if (d < -r)
+            rc = CULL_OUTSIDE;
+        else if (d < r)
+            rc = CULL_PARTIAL;
+    }
+
+    return rc;
+}
+
+// classify classifies n spheres held in structure-of-arrays form - centres
+// x[i], y[i], z[i] and radii r[i] - and stores the containment of sphere i
+// in result[i]
+//
+// the SSE version tests four spheres against each plane at once and stops
+// as soon as all four lie wholly behind one plane
+//
+void Frustum::classify(const float* x, const float* y, const float* z,
+ const float* r, unsigned n, unsigned char* result) const {
+
+    unsigned i = 0;
+
+    #ifdef FRUSTUM_SSE
+    __m128 nx[6], ny[6], nz[6], nd[6];
+    for (int p = 0; p < 6; p++) {
+        nx[p] = _mm_set1_ps(plane[p].n.x);
+        ny[p] = _mm_set1_ps(plane[p].n.y);
+        nz[p] = _mm_set1_ps(plane[p].n.z);
+        nd[p] = _mm_set1_ps(plane[p].d);
+    }
+    for (; i + 4 <= n; i += 4) {
+        __m128 px  = _mm_loadu_ps(x + i);
+        __m128 py  = _mm_loadu_ps(y + i);
+        __m128 pz  = _mm_loadu_ps(z + i);
+        __m128 pr  = _mm_loadu_ps(r + i);
+        __m128 nr  = _mm_sub_ps(_mm_setzero_ps(), pr);
+        __m128 out = _mm_setzero_ps();
+        __m128 in  = _mm_cmpeq_ps(pr, pr);
+        for (int p = 0; p < 6 && _mm_movemask_ps(out) != 0xF; p++) {
+            __m128 d = _mm_add_ps(
+             _mm_add_ps(_mm_mul_ps(px, nx[p]), _mm_mul_ps(py, ny[p])),
+             _mm_add_ps(_mm_mul_ps(pz, nz[p]), nd[p]));
+            out = _mm_or_ps(out, _mm_cmplt_ps(d, nr));
+            in  = _mm_and_ps(in, _mm_cmpge_ps(d, pr));
+        }
+        int o = _mm_movemask_ps(out);
+        int s = _mm_movemask_ps(in);
+        for (int k = 0; k < 4; k++)
+            result[i + k] = (unsigned char)((o >> k & 1) ? CULL_OUTSIDE :
+             (s >> k & 1) ? CULL_INSIDE : CULL_PARTIAL);
+    }
+    #endif
+
+    // remaining spheres
+    for (; i < n; i++)
+        result[i] = (unsigned char)classify(Vector(x[i], y[i], z[i]), r[i]);
+}
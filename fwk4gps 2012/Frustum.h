@@ -0,0 +1,40 @@
+#ifndef _FRUSTUM_H_
+#define _FRUSTUM_H_
+
+/* Frustum Definition - Modelling Layer
+ *
+ * Frustum.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "MathDeclarations.h" // for Plane, Matrix and Vector
+
+// containment of a bounding sphere with respect to the view frustum
+//
+typedef enum Containment {
+    CULL_OUTSIDE,
+    CULL_PARTIAL,
+    CULL_INSIDE
+} Containment;
+
+//-------------------------------- Frustum ------------------------------------
+//
+// The Frustum class holds the bounding planes of the view volume and
+// classifies bounding spheres against them
+//
+class Frustum {
+
+    Plane plane[6]; // left, right, bottom, top, near, far - normals inwards
+
+  public:
+    void extract(const Matrix& viewProjection);
+    Containment classify(const Vector& c, float r) const;
+    void classify(const float* x, const float* y, const float* z,
+     const float* r, unsigned n, unsigned char* result) const;
+};
+
+#endif
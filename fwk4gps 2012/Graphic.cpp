@@ -1,296 +1,802 @@
-/* Graphic and Vertex Implementations - Modelling Layer
- *
- * Graphic.cpp
- * fwk4gps version 3.0
- * gam666/dps901/gam670/dps905
- * January 14 2012
- * copyright (c) 2012 Chris Szalwinski 
- * distributed under TPL - see ../Licenses.txt
- */
-
-#include <fstream>
-#include "Graphic.h"         // for Vertex and Graphic class definitions
-#include "iCoordinator.h"    // for the Coordinator Interface
-#include "iAPIGraphic.h"     // for the APIGraphic Interface
-#include "iUtilities.h"      // for error()
-
-#include "VertexList.h"      // for the VertexList template
-#include "MathDefinitions.h" // for Vector and MODEL_Z_AXIS
-#include "ModellingLayer.h"  // for ASSET_DIRECTORY
-#include "Common_Symbols.h"  // symbols common to Modelling/Translation layers
-
-//-------------------------------- Vertex -------------------------------------
-//
-// Vertex holds the data for a single normal vertex
-//
-// constructors initialize the vertex to the values received
-//
-Vertex::Vertex() : x(0), y(0), z(0), nx(0), ny(0), nz(0), tu(0), tv(0) {}
-
-Vertex::Vertex(const Vector& p, const Vector& n, float ttu, float ttv) :
- x(p.x), y(p.y), z(p.z * MODEL_Z_AXIS), nx(n.x), ny(n.y), nz(n.z), tu(ttu), 
- tv(ttv) {}
-
-// populate populates *pv with the vertex data
-//
-void Vertex::populate(void** pv) const {
-    float* p = *(float**)pv;
-
-    *p++ = x;
-    *p++ = y;
-    *p++ = z;
-    *p++ = nx;
-    *p++ = ny;
-    *p++ = nz;
-    *p++ = tu;
-    *p++ = tv;
-    *pv  = p;
-}
-
-// position returns the position of the vertex in local coordinates
-//
-Vector Vertex::position() const {
-    return Vector(x, y, z);
-}
-
-//-------------------------------- LitVertex ----------------------------------
-//
-// LitVertex holds the data for a single lit vertex
-//
-LitVertex::LitVertex() : x(0), y(0), z(0), c(0) {}
-
-LitVertex::LitVertex(const Vector& p, const Colour& x, float ttu, 
- float ttv) : x(p.x), y(p.y), z(p.z * MODEL_Z_AXIS), c(x) {}
-
-// populate populates *pv with the vertex data
-//
-void  LitVertex::populate(void** pv) const {
-    float* p = *(float**)pv;
-
-    *p++ = x;
-    *p++ = y;
-    *p++ = z;
-    *((unsigned*)p++) = COLOUR_TO_ARGB(c);
-    *pv  = p;
-}
-
-// position returns the position of the vertex in local coordinates
-//
-Vector LitVertex::position() const {
-    return Vector(x, y, z);
-}
-
-//-------------------------------- Graphic ---------------------------------
-//
-// The Graphic class is the base class of the Graphic hierarchy
-//
-// constructor adds the Graphic to the coordinator
-//
-Graphic::Graphic() {
-
-    coordinator->add(this);
-}
-
-Graphic::Graphic(const Graphic& src) {
-
-    coordinator->add(this);
-    *this = src;
-}
-
-// destructor removes the Graphic from the coordinator
-//
-Graphic::~Graphic() {
-
-    coordinator->remove(this);
-}
-
-//-------------------------------- Graphic Structures -------------------------
-//
-// prototype for add() function used by the Create...() functions
-void add(VertexList<Vertex>* vertexList, const Vector& p1, 
- const Vector& p2, const Vector& p3, const Vector& p4, const Vector& n);
-
-// CreateBox builds a triangle vertex list for a brick-like box from two
-// extreme points one face at a time with all faces having the same attributes
-//
-iGraphic* CreateBox(float minx, float miny, float minz, float maxx, 
- float maxy, float maxz) {
-    
-    VertexList<Vertex>* vertexList = 
-     (VertexList<Vertex>*)CreateVertexList<Vertex>(TRIANGLE_LIST, 12);
-
-    float x = (minx + maxx) / 2;
-    float y = (miny + maxy) / 2;
-    float z = (minz + maxz) / 2;
-    minx -= x;
-    miny -= y;
-    minz -= z;
-    maxx -= x;
-    maxy -= y;
-    maxz -= z;
-    // locate centroid at origin
-    Vector p1 = Vector(minx, miny, minz),
-           p2 = Vector(minx, maxy, minz),
-           p3 = Vector(maxx, maxy, minz),
-           p4 = Vector(maxx, miny, minz),
-           p5 = Vector(minx, miny, maxz),
-           p6 = Vector(minx, maxy, maxz),
-           p7 = Vector(maxx, maxy, maxz),
-           p8 = Vector(maxx, miny, maxz);
-    add(vertexList, p1, p2, p3, p4, Vector(0, 0, -1)); // front
-    add(vertexList, p4, p3, p7, p8, Vector(1, 0,  0)); // right
-    add(vertexList, p8, p7, p6, p5, Vector(0, 0,  1)); // back
-    add(vertexList, p6, p2, p1, p5, Vector(-1, 0, 0)); // left
-    add(vertexList, p1, p4, p8, p5, Vector(0, -1, 0)); // bottom
-    add(vertexList, p2, p6, p7, p3, Vector(0, 1,  0)); // top
-
-    return vertexList;
-}
-
-// CreateGrid builds a grid-like line list of n by n lines in the x-z plane
-//
-iGraphic* CreateGrid(float min, float max, int n) {
-    
-    VertexList<Vertex>* vertexList = 
-     (VertexList<Vertex>*)CreateVertexList<Vertex>(LINE_LIST, 2*n+2);
-
-    float x = (min + max) / 2;
-    min -= x;
-    max -= x;
-    float cur = min, inc = (max - min) / float(n - 1);
-    for (int i = 0; i < n; i++, cur += inc) {
-        // in the local x direction
-        vertexList->add(Vertex(Vector(min, 0, cur), Vector(0, 1, 0)));
-        vertexList->add(Vertex(Vector(max, 0, cur), Vector(0, 1, 0)));
-        // in the local z direction
-        vertexList->add(Vertex(Vector(cur, 0, min), Vector(0, 1, 0)));
-        vertexList->add(Vertex(Vector(cur, 0, max), Vector(0, 1, 0)));
-    }
-
-    return vertexList;
-}
-
-// CreateRectangleList builds a triangle list in the x-y plane from its two 
-// extreme points
-//
-iGraphic* CreateRectangleList(float minx, float miny, float maxx, float maxy) {
-    
-    VertexList<Vertex>* vertexList = 
-     (VertexList<Vertex>*)CreateVertexList<Vertex>(TRIANGLE_LIST, 2);
-
-    float x = (minx + maxx) / 2, y = (miny + maxy) / 2;
-    minx -= x;
-    miny -= y;
-    maxx -= x;
-    maxy -= y;
-    // locate centroid at origin
-    Vector p1 = Vector(minx, miny, 0),
-           p2 = Vector(minx, maxy, 0),
-           p3 = Vector(maxx, maxy, 0),
-           p4 = Vector(maxx, miny, 0);
-    add(vertexList, p1, p2, p3, p4, Vector(0, 0, -1)); 
-    
-    return vertexList;
-}
-
-// TriangleList reads a triangle list form file
-//
-iGraphic* TriangleList(const wchar_t* file) {
-    
-    iGraphic* graphic = nullptr;
-
-	// construct filename with path
-	int len = strlen(file) + strlen(ASSET_DIRECTORY) + 1;
-	wchar_t* absFile = new wchar_t[len + 1];
-	nameWithDir(absFile, ASSET_DIRECTORY, file, len);
-
-    // open file for input
-    std::wifstream in(absFile, std::ios::in);
-    delete [] absFile;
-
-    float x, y, z, nx, ny, nz, tu, tv, xc = 0, yc = 0, zc = 0;
-    unsigned no = 0;
-
-    // count the number of records
-    while (in) { 
-        in >> x >> y >> z >> nx >> ny >> nz >> tu >> tv;
-        xc += x;
-        yc += y;
-        zc += z;
-        no++;
-    }
-    in.clear();
-    in.seekg(0);
-    if (no) {
-        VertexList<Vertex>* vertexList = 
-         (VertexList<Vertex>*)CreateVertexList<Vertex>(TRIANGLE_LIST, no);
-        xc /= no;
-        yc /= no;
-        zc /= no;
-        for (unsigned i = 0; i < no; i++) {
-            in >> x >> y >> z >> nx >> ny >> nz >> tu >> tv;
-            vertexList->add(Vertex(Vector(x - xc, y - yc, (z - zc) * MODEL_Z_AXIS), 
-                Vector(nx, ny, nz), tu, tv));
-        }
-        graphic = vertexList;
-    }
-    
-    return graphic;
-}
-
-// TriangleList reads a triangle list from file
-//
-iGraphic* TriangleList(const wchar_t* file, const Colour& colour) {
-    
-    iGraphic* graphic = nullptr;
-
-	// construct filename with path
-	int len = strlen(file) + strlen(ASSET_DIRECTORY) + 1;
-	wchar_t* absFile = new wchar_t[len + 1];
-	::nameWithDir(absFile, ASSET_DIRECTORY, file, len);
-
-    // open file for input
-    std::wifstream in(absFile, std::ios::in);
-    delete [] absFile;
-
-    float x, y, z, xc = 0, yc = 0, zc = 0;
-    unsigned no = 0;
-
-    // count the number of records
-    while (in) { 
-        in >> x >> y >> z;
-        xc += x;
-        yc += y;
-        zc += z;
-        no++;
-    }
-    in.clear();
-    in.seekg(0);
-    if (no) {
-        VertexList<LitVertex>* vertexList = 
-         (VertexList<LitVertex>*)CreateVertexList<LitVertex>(TRIANGLE_LIST, no);
-        xc /= no;
-        yc /= no;
-        zc /= no;
-        for (unsigned i = 0; i < no; i++) {
-            in >> x >> y >> z;
-            vertexList->add(LitVertex(Vector(x - xc, y - yc, (z - zc) * MODEL_Z_AXIS), 
-                colour));
-        }
-        graphic = vertexList;
-    }
-    
-    return graphic;
-}
-
-void add(VertexList<Vertex>* vertexList, const Vector& p1, const Vector& p2, 
- const Vector& p3, const Vector& p4, const Vector& n) {
-
-    vertexList->add(Vertex(p1, n, 1, 0));
-    vertexList->add(Vertex(p2, n, 0, 0));
-    vertexList->add(Vertex(p3, n, 0, 1));
-    vertexList->add(Vertex(p1, n, 1, 0));
-    vertexList->add(Vertex(p3, n, 0, 1));
-    vertexList->add(Vertex(p4, n, 1, 1));
-}
-
+/* Graphic and Vertex Implementations - Modelling Layer
+ *
+ * Graphic.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <vector>
+#include "Graphic.h"         // for Vertex and Graphic class definitions
+#include "iCoordinator.h"    // for the Coordinator Interface
+#include "iAPIGraphic.h"     // for the APIGraphic Interface
+#include "iUtilities.h"      // for error()
+
+#include "VertexList.h"      // for the VertexList template
+#include "IndexedVertexList.h" // for the IndexedVertexList template
+#include "MeshFile.h"        // for the binary mesh format
+#include "VertexCodec.h"     // for the packed vertex format
+#include "MeshOptimizer.h"   // for boundingVolume
+#include "FloatReader.h"     // for the FloatReader class definition
+#include "iAPIMappedFile.h"  // for the APIMappedFile Interface
+#include "iAssetLoader.h"    // for the AssetLoader Interface
+#include "MathDefinitions.h" // for Vector and MODEL_Z_AXIS
+#include "ModellingLayer.h"  // for ASSET_DIRECTORY
+#include "Common_Symbols.h"  // symbols common to Modelling/Translation layers
+
+//-------------------------------- Vertex -------------------------------------
+//
+// Vertex holds the data for a single normal vertex
+//
+// constructors initialize the vertex to the values received
+//
+Vertex::Vertex() : x(0), y(0), z(0), nx(0), ny(0), nz(0), tu(0), tv(0) {}
+
+Vertex::Vertex(const Vector& p, const Vector& n, float ttu, float ttv) :
+ x(p.x), y(p.y), z(p.z * MODEL_Z_AXIS), nx(n.x), ny(n.y), nz(n.z), tu(ttu), 
+ tv(ttv) {}
+
+// position returns the position of the vertex in local coordinates
+//
+Vector Vertex::position() const {
+    return Vector(x, y, z);
+}
+
+// transform transforms the vertex by world and its normal by normals
+//
+void Vertex::transform(const Matrix& world, const Matrix& normals) {
+
+    Vector p = Vector(x, y, z) * world;
+    Vector n = normal(Vector(nx, ny, nz) * normals);
+    x  = p.x;
+    y  = p.y;
+    z  = p.z;
+    nx = n.x;
+    ny = n.y;
+    nz = n.z;
+}
+
+//-------------------------------- LitVertex ----------------------------------
+//
+// LitVertex holds the data for a single lit vertex
+//
+LitVertex::LitVertex() : x(0), y(0), z(0), c(0) {}
+
+// the colour is packed once here rather than at each upload
+//
+LitVertex::LitVertex(const Vector& p, const Colour& colour, float ttu, 
+ float ttv) : x(p.x), y(p.y), z(p.z * MODEL_Z_AXIS), 
+ c(COLOUR_TO_ARGB(colour)) {}
+
+// position returns the position of the vertex in local coordinates
+//
+Vector LitVertex::position() const {
+    return Vector(x, y, z);
+}
+
+// transform transforms the vertex by world - a lit vertex has no normal
+//
+void LitVertex::transform(const Matrix& world, const Matrix&) {
+
+    Vector p = Vector(x, y, z) * world;
+    x = p.x;
+    y = p.y;
+    z = p.z;
+}
+
+//-------------------------------- Graphic ---------------------------------
+//
+// The Graphic class is the base class of the Graphic hierarchy
+//
+// constructor adds the Graphic to the coordinator
+//
+Graphic::Graphic() : radius(0), bounded(false) {
+
+    coordinator->add(this);
+}
+
+Graphic::Graphic(const Graphic& src) {
+
+    coordinator->add(this);
+    *this = src;
+}
+
+// destructor removes the Graphic from the coordinator
+//
+Graphic::~Graphic() {
+
+    coordinator->remove(this);
+}
+
+// bounds returns the radius of the bounding sphere of the n vertices at 
+// vertex, stride bytes apart, and stores the bounding box in min and max 
+// and the centre of the sphere in c - the vertices start with their 
+// position - the bounds are computed on the first call after bounded has 
+// been cleared and cached until it is cleared again
+//
+float Graphic::bounds(const void* vertex, unsigned stride, unsigned n,
+ Vector& min, Vector& max, Vector& c) const {
+
+    if (!bounded) {
+        float mn[3], mx[3], cc[3];
+        radius  = boundingVolume((const float*)vertex, stride, n, mn, mx, cc);
+        minimum = Vector(mn[0], mn[1], mn[2]);
+        maximum = Vector(mx[0], mx[1], mx[2]);
+        centre  = Vector(cc[0], cc[1], cc[2]);
+        bounded = true;
+    }
+    min = minimum;
+    max = maximum;
+    c   = centre;
+
+    return radius;
+}
+
+//-------------------------------- Graphic Structures -------------------------
+//
+// prototype for add() function used by the Create...() functions
+void add(IndexedVertexList<Vertex>* vertexList, const Vector& p1, 
+ const Vector& p2, const Vector& p3, const Vector& p4, const Vector& n);
+
+// CreateBox builds an indexed triangle list for a brick-like box from two
+// extreme points one face at a time with all faces having the same attributes
+//
+iGraphic* CreateBox(float minx, float miny, float minz, float maxx, 
+ float maxy, float maxz) {
+    
+    IndexedVertexList<Vertex>* vertexList = (IndexedVertexList<Vertex>*)
+     CreateIndexedVertexList<Vertex>(TRIANGLE_LIST, 12);
+
+    float x = (minx + maxx) / 2;
+    float y = (miny + maxy) / 2;
+    float z = (minz + maxz) / 2;
+    minx -= x;
+    miny -= y;
+    minz -= z;
+    maxx -= x;
+    maxy -= y;
+    maxz -= z;
+    // locate centroid at origin
+    Vector p1 = Vector(minx, miny, minz),
+           p2 = Vector(minx, maxy, minz),
+           p3 = Vector(maxx, maxy, minz),
+           p4 = Vector(maxx, miny, minz),
+           p5 = Vector(minx, miny, maxz),
+           p6 = Vector(minx, maxy, maxz),
+           p7 = Vector(maxx, maxy, maxz),
+           p8 = Vector(maxx, miny, maxz);
+    add(vertexList, p1, p2, p3, p4, Vector(0, 0, -1)); // front
+    add(vertexList, p4, p3, p7, p8, Vector(1, 0,  0)); // right
+    add(vertexList, p8, p7, p6, p5, Vector(0, 0,  1)); // back
+    add(vertexList, p6, p2, p1, p5, Vector(-1, 0, 0)); // left
+    add(vertexList, p1, p4, p8, p5, Vector(0, -1, 0)); // bottom
+    add(vertexList, p2, p6, p7, p3, Vector(0, 1,  0)); // top
+
+    return vertexList;
+}
+
+// CreateGrid builds an indexed line list of n by n lines in the x-z plane
+//
+iGraphic* CreateGrid(float min, float max, int n) {
+    
+    IndexedVertexList<Vertex>* vertexList = (IndexedVertexList<Vertex>*)
+     CreateIndexedVertexList<Vertex>(LINE_LIST, 2*n+2);
+
+    float x = (min + max) / 2;
+    min -= x;
+    max -= x;
+    float cur = min, inc = (max - min) / float(n - 1);
+    for (int i = 0; i < n; i++, cur += inc) {
+        // in the local x direction
+        vertexList->add(Vertex(Vector(min, 0, cur), Vector(0, 1, 0)));
+        vertexList->add(Vertex(Vector(max, 0, cur), Vector(0, 1, 0)));
+        // in the local z direction
+        vertexList->add(Vertex(Vector(cur, 0, min), Vector(0, 1, 0)));
+        vertexList->add(Vertex(Vector(cur, 0, max), Vector(0, 1, 0)));
+    }
+
+    return vertexList;
+}
+
+// CreateRectangleList builds an indexed triangle list in the x-y plane from
+// its two extreme points
+//
+iGraphic* CreateRectangleList(float minx, float miny, float maxx, float maxy) {
+    
+    IndexedVertexList<Vertex>* vertexList = (IndexedVertexList<Vertex>*)
+     CreateIndexedVertexList<Vertex>(TRIANGLE_LIST, 2);
+
+    float x = (minx + maxx) / 2, y = (miny + maxy) / 2;
+    minx -= x;
+    miny -= y;
+    maxx -= x;
+    maxy -= y;
+    // locate centroid at origin
+    Vector p1 = Vector(minx, miny, 0),
+           p2 = Vector(minx, maxy, 0),
+           p3 = Vector(maxx, maxy, 0),
+           p4 = Vector(maxx, miny, 0);
+    add(vertexList, p1, p2, p3, p4, Vector(0, 0, -1)); 
+    
+    return vertexList;
+}
+
+// readRecords reads the complete records of n floats from file in a single
+// pass into record and returns the number of records - the centroid of the
+// first three coordinates of every record is stored in c
+//
+static unsigned readRecords(const wchar_t* file, unsigned n, 
+ std::vector<float>& record, Vector& c) {
+
+	// construct filename with path
+	int len = strlen(file) + strlen(ASSET_DIRECTORY) + 1;
+	wchar_t* absFile = new wchar_t[len + 1];
+	nameWithDir(absFile, ASSET_DIRECTORY, file, len);
+
+    // open file for input
+    FloatReader in(absFile);
+    delete [] absFile;
+
+    // about five characters per number in typical assets
+    record.clear();
+    record.reserve(in.size() / 5);
+    double xc = 0, yc = 0, zc = 0;
+    float  f[8];
+    while (in.read(f, n)) {
+        record.insert(record.end(), f, f + n);
+        xc += f[0];
+        yc += f[1];
+        zc += f[2];
+    }
+    unsigned no = record.size() / n;
+    if (no) c = Vector((float)(xc / no), (float)(yc / no), (float)(zc / no));
+
+    return no;
+}
+
+// recentre moves the origin of the no records of n floats to centroid c
+// in place and orients their z axis
+//
+static void recentre(std::vector<float>& record, unsigned n, unsigned no, 
+ const Vector& c) {
+
+    for (unsigned i = 0; i < no; i++) {
+        float* r = &record[i * n];
+        r[0] -= c.x;
+        r[1] -= c.y;
+        r[2]  = (r[2] - c.z) * MODEL_Z_AXIS;
+    }
+}
+
+// TriangleList reads a triangle list from file and welds the identical
+// vertices into an indexed triangle list
+//
+iGraphic* TriangleList(const wchar_t* file) {
+    
+    iGraphic* graphic = nullptr;
+    std::vector<float> record;
+    Vector c;
+
+    // x y z nx ny nz tu tv records
+    unsigned no = readRecords(file, 8, record, c);
+    if (no >= 3) {
+        recentre(record, 8, no, c);
+        IndexedVertexList<Vertex>* vertexList = (IndexedVertexList<Vertex>*)
+         CreateIndexedVertexList<Vertex>(TRIANGLE_LIST, no / 3);
+        for (unsigned i = 0; i < no; i++) {
+            const float* r = &record[i * 8];
+            vertexList->add(Vertex(Vector(r[0], r[1], r[2]), 
+                Vector(r[3], r[4], r[5]), r[6], r[7]));
+        }
+        vertexList->optimize();
+        graphic = vertexList;
+    }
+    
+    return graphic;
+}
+
+// TriangleList reads a triangle list of coloured vertices from file and
+// welds the identical vertices into an indexed triangle list
+//
+iGraphic* TriangleList(const wchar_t* file, const Colour& colour) {
+    
+    iGraphic* graphic = nullptr;
+    std::vector<float> record;
+    Vector c;
+
+    // x y z records
+    unsigned no = readRecords(file, 3, record, c);
+    if (no >= 3) {
+        recentre(record, 3, no, c);
+        IndexedVertexList<LitVertex>* vertexList = 
+         (IndexedVertexList<LitVertex>*)
+         CreateIndexedVertexList<LitVertex>(TRIANGLE_LIST, no / 3);
+        for (unsigned i = 0; i < no; i++) {
+            const float* r = &record[i * 3];
+            vertexList->add(LitVertex(Vector(r[0], r[1], r[2]), colour));
+        }
+        vertexList->optimize();
+        graphic = vertexList;
+    }
+    
+    return graphic;
+}
+
+// fits returns true if n elements of s bytes each starting at offset lie
+// within a file of size bytes - the test divides rather than multiplies so
+// that a corrupt count cannot wrap past the end of the file
+//
+static bool fits(unsigned offset, unsigned n, unsigned s, unsigned size) {
+
+    return offset <= size && (!s || n <= (size - offset) / s);
+}
+
+// openMesh maps binary mesh file into memory and checks that its header
+// describes a triangle list with attributes a - returns nullptr if the
+// file cannot be used
+//
+static iAPIMappedFile* openMesh(const wchar_t* file, unsigned a) {
+
+	// construct filename with path
+	int len = strlen(file) + strlen(ASSET_DIRECTORY) + 1;
+	wchar_t* absFile = new wchar_t[len + 1];
+	nameWithDir(absFile, ASSET_DIRECTORY, file, len);
+
+    iAPIMappedFile* m = CreateAPIMappedFile(absFile);
+    delete [] absFile;
+    if (!m) return nullptr;
+
+    const MeshHeader* h = (const MeshHeader*)m->data();
+    unsigned size = m->size();
+    if (size < sizeof(MeshHeader) || h->magic != MESH_MAGIC || 
+     h->version != MESH_VERSION || h->headerSize != sizeof(MeshHeader) ||
+     h->fileSize != size || h->attributes != a ||
+     (h->indexSize != 2 && h->indexSize != 4) || h->nIndices < 3 ||
+     h->nIndices % 3 || h->vertexOffset % MESH_ALIGN || 
+     h->indexOffset % MESH_ALIGN ||
+     !fits(h->vertexOffset, h->nVertices, h->vertexSize, size) ||
+     !fits(h->indexOffset, h->nIndices, h->indexSize, size)) {
+        m->Delete();
+        m = nullptr;
+    }
+
+    return m;
+}
+
+// Mesh maps a binary mesh file of textured vertices and copies its vertex
+// and index blobs into an indexed triangle list without parsing
+//
+iGraphic* Mesh(const wchar_t* file) {
+
+    iGraphic* graphic = nullptr;
+    iAPIMappedFile* m = openMesh(file, MESH_VERTEX);
+
+    if (m) {
+        const unsigned char* b = (const unsigned char*)m->data();
+        const MeshHeader* h = (const MeshHeader*)b;
+        if (h->vertexSize == sizeof(Vertex)) {
+            IndexedVertexList<Vertex>* vertexList = 
+             (IndexedVertexList<Vertex>*)
+             CreateIndexedVertexList<Vertex>(TRIANGLE_LIST, h->nIndices / 3);
+            if (vertexList->load(b + h->vertexOffset, h->nVertices,
+             b + h->indexOffset, h->nIndices, h->indexSize))
+                graphic = vertexList;
+            else
+                vertexList->Delete();
+        }
+        m->Delete();
+    }
+
+    return graphic;
+}
+
+// Mesh maps a binary mesh file of positions and builds an indexed triangle
+// list of vertices of the specified colour
+//
+iGraphic* Mesh(const wchar_t* file, const Colour& colour) {
+
+    iGraphic* graphic = nullptr;
+    iAPIMappedFile* m = openMesh(file, MESH_POSITIONS);
+
+    if (m) {
+        const unsigned char* b = (const unsigned char*)m->data();
+        const MeshHeader* h = (const MeshHeader*)b;
+        if (h->vertexSize == 3 * sizeof(float) && 
+         h->nVertices <= h->nIndices) {
+            IndexedVertexList<LitVertex>* vertexList = 
+             (IndexedVertexList<LitVertex>*)
+             CreateIndexedVertexList<LitVertex>(TRIANGLE_LIST, 
+             h->nIndices / 3);
+            const float* p = (const float*)(b + h->vertexOffset);
+            LitVertex* v = new LitVertex[h->nVertices];
+            // the constructor reapplies MODEL_Z_AXIS to the stored z
+            for (unsigned i = 0; i < h->nVertices; i++, p += 3)
+                v[i] = LitVertex(Vector(p[0], p[1], p[2] * MODEL_Z_AXIS),
+                 colour);
+            if (vertexList->load(v, h->nVertices, b + h->indexOffset, 
+             h->nIndices, h->indexSize))
+                graphic = vertexList;
+            else
+                vertexList->Delete();
+            delete [] v;
+        }
+        m->Delete();
+    }
+
+    return graphic;
+}
+
+//-------------------------------- PackedVertexList ---------------------------
+//
+// The PackedVertexList class holds an indexed triangle list of textured
+// vertices in packed form - a 16-byte PackedVertex in place of each 32-byte
+// Vertex and 16-bit indices wherever they address all of the vertices - and
+// decodes the vertices into the Vertex format as they are uploaded - it is
+// never merged into a static batch
+//
+class PackedVertexList : public Graphic {
+
+    unsigned        no;            // number of vertices
+    PackedVertex*   vertex;        // points to the array of packed vertices
+    unsigned        nIndices;      // number of indices
+    unsigned short* shortIndex;    // 16-bit indices - nullptr if wide
+    unsigned*       wideIndex;     // 32-bit indices - nullptr if narrow
+    float           bias[3];       // minimum corner of the positions
+    float           scale[3];      // size of one quantization step
+    iAPIGraphic*    apiVertexList; // points to the API Primitive Set
+    unsigned        nPrimitives;   // number of primitives
+
+    PackedVertexList& operator=(const PackedVertexList&);
+    virtual ~PackedVertexList();
+
+  public:
+    PackedVertexList(const IndexedVertexList<Vertex>* src);
+    PackedVertexList(const PackedVertexList& src);
+    void*  clone() const               { return new PackedVertexList(*this); }
+    void   upload(void* pv, unsigned n) const {
+        unpackVertices(vertex, n, bias, scale, (float*)pv);
+    }
+    Vector position(int i) const;
+    float  bounds(Vector& min, Vector& max, Vector& c) const;
+    unsigned noIndices() const         { return nIndices; }
+    unsigned index(unsigned i) const {
+        return shortIndex ? shortIndex[i] : wideIndex[i];
+    }
+    bool   prepare()                   { return apiVertexList->prepare(no); }
+    void   render()                    { apiVertexList->draw(no); }
+    void   render(const Matrix* w, unsigned n) {
+        apiVertexList->draw(no, w, n);
+    }
+    unsigned  noPrimitives() const     { return nPrimitives; }
+    unsigned  batchKey() const         { return 0; }
+    iGraphic* merge(iGraphic* const*, const Matrix*, unsigned) const {
+        return nullptr;
+    }
+    iGraphic* simplify(float) const    { return nullptr; }
+    void   suspend()                   { apiVertexList->suspend(); }
+    void   release()                   { apiVertexList->release(); }
+    void   Delete() const              { delete this; }
+};
+
+// pack replaces indexed list g with its packed form - returns nullptr if
+// g is nullptr
+//
+static iGraphic* pack(iGraphic* g) {
+
+    iGraphic* packed = nullptr;
+    if (g) {
+        packed = new PackedVertexList((IndexedVertexList<Vertex>*)g);
+        g->Delete();
+    }
+
+    return packed;
+}
+
+// PackedTriangleList reads a triangle list from file as TriangleList does
+// and stores it in packed form
+//
+iGraphic* PackedTriangleList(const wchar_t* file) {
+
+    return pack(TriangleList(file));
+}
+
+// PackedMesh maps a binary mesh file of textured vertices as Mesh does and
+// stores it in packed form
+//
+iGraphic* PackedMesh(const wchar_t* file) {
+
+    return pack(Mesh(file));
+}
+
+// constructor encodes the vertices and the indices of src and creates the
+// Translation in the Vertex format
+//
+PackedVertexList::PackedVertexList(const IndexedVertexList<Vertex>* src) :
+ no(src->noVertices()), nIndices(src->noIndices()), shortIndex(nullptr),
+ wideIndex(nullptr), nPrimitives(src->noPrimitives()) {
+
+    vertex = new PackedVertex[no ? no : 1];
+    packVertices((const float*)src->vertices(), no, vertex, bias, scale);
+    if (no <= 0x10000) {
+        shortIndex = new unsigned short[nIndices ? nIndices : 1];
+        for (unsigned i = 0; i < nIndices; i++)
+            shortIndex[i] = (unsigned short)src->index(i);
+    }
+    else {
+        wideIndex = new unsigned[nIndices];
+        for (unsigned i = 0; i < nIndices; i++)
+            wideIndex[i] = src->index(i);
+    }
+
+    apiVertexList = CreateAPIVertexList(TRIANGLE_LIST, nPrimitives,
+     Vertex::vertexSize(), Vertex::vertexFormat(), (iGraphic*)this);
+}
+
+// copy constructor copies the packed lists and clones the Translation
+//
+PackedVertexList::PackedVertexList(const PackedVertexList& src) : 
+ Graphic(src), no(src.no), nIndices(src.nIndices), shortIndex(nullptr),
+ wideIndex(nullptr), nPrimitives(src.nPrimitives) {
+
+    vertex = new PackedVertex[no ? no : 1];
+    memcpy(vertex, src.vertex, no * sizeof(PackedVertex));
+    if (src.shortIndex) {
+        shortIndex = new unsigned short[nIndices ? nIndices : 1];
+        memcpy(shortIndex, src.shortIndex, nIndices * sizeof(unsigned short));
+    }
+    else {
+        wideIndex = new unsigned[nIndices];
+        memcpy(wideIndex, src.wideIndex, nIndices * sizeof(unsigned));
+    }
+    for (unsigned k = 0; k < 3; k++) {
+        bias[k]  = src.bias[k];
+        scale[k] = src.scale[k];
+    }
+    apiVertexList = src.apiVertexList->clone();
+    apiVertexList->attach((iGraphic*)this);
+}
+
+// position returns the decoded position of vertex i in local coordinates
+//
+Vector PackedVertexList::position(int i) const {
+
+    const PackedVertex& p = vertex[i];
+    return Vector(p.x * scale[0] + bias[0], p.y * scale[1] + bias[1],
+     p.z * scale[2] + bias[2]);
+}
+
+// bounds decodes the positions on the first call and returns the bounds
+// of the decoded positions from then on
+//
+float PackedVertexList::bounds(Vector& min, Vector& max, Vector& c) const {
+
+    std::vector<Vector> p;
+    if (!bounded) {
+        p.resize(no ? no : 1);
+        for (unsigned i = 0; i < no; i++)
+            p[i] = position(i);
+    }
+
+    return Graphic::bounds(p.empty() ? nullptr : &p[0].x, sizeof(Vector), no,
+     min, max, c);
+}
+
+// destructor deletes the Translation and the lists
+//
+PackedVertexList::~PackedVertexList() {
+
+    apiVertexList->Delete();
+    delete [] vertex;
+    delete [] shortIndex;
+    delete [] wideIndex;
+}
+
+//-------------------------------- AsyncGraphic -------------------------------
+//
+// The AsyncGraphic class stands in for a graphic that is loaded
+// asynchronously - it draws a placeholder box until the loaded graphic is
+// handed to it and forwards every call to the loaded graphic from then on
+// - it owns both graphics, withdrawing them from the coordinator, and is
+// never merged into a static batch
+//
+class AsyncGraphic : public Graphic {
+
+    iGraphic* placeholder; // drawn until the loaded graphic arrives
+    iGraphic* graphic;     // loaded graphic - nullptr until it arrives
+    unsigned  handle;      // asynchronous load request - 0 if none
+    int       priority;    // priority of the load requests
+
+    AsyncGraphic(const AsyncGraphic&);
+    AsyncGraphic& operator=(const AsyncGraphic&);
+    virtual ~AsyncGraphic();
+    iGraphic* current() const { return graphic ? graphic : placeholder; }
+
+  public:
+    AsyncGraphic(int p);
+    void   request(iAssetJob* job);
+    void   build(std::vector<float>& record, unsigned no);
+    void   loaded(iGraphic* g);
+    void   upload(void* pv, unsigned n) const { current()->upload(pv, n); }
+    Vector position(int i) const            { return current()->position(i); }
+    float  bounds(Vector& min, Vector& max, Vector& c) const {
+        return current()->bounds(min, max, c);
+    }
+    unsigned noIndices() const              { return current()->noIndices(); }
+    unsigned index(unsigned i) const        { return current()->index(i); }
+    bool   prepare()                        { return current()->prepare(); }
+    void   render()                         { current()->render(); }
+    void   render(const Matrix* w, unsigned n) { current()->render(w, n); }
+    unsigned  noPrimitives() const { return current()->noPrimitives(); }
+    unsigned  batchKey() const              { return 0; }
+    iGraphic* merge(iGraphic* const*, const Matrix*, unsigned) const {
+        return nullptr;
+    }
+    iGraphic* simplify(float r) const {
+        return graphic ? graphic->simplify(r) : nullptr;
+    }
+    void   suspend();
+    void   release();
+    void   Delete() const                   { delete this; }
+};
+
+// RecordJob reads the records of a triangle list file on a worker thread
+// and has the AsyncGraphic create the list for them at a frame boundary
+//
+class RecordJob : public iAssetJob {
+
+    AsyncGraphic*      owner;  // graphic that requested the records
+    wchar_t*           file;   // triangle list file - owned by the job
+    std::vector<float> record; // x y z nx ny nz tu tv records
+    unsigned           no;     // number of records
+
+    RecordJob(const RecordJob&);
+    RecordJob& operator=(const RecordJob&);
+    virtual ~RecordJob() { delete [] file; }
+
+  public:
+    RecordJob(AsyncGraphic* o, wchar_t* f) : owner(o), file(f), no(0) {}
+    bool load() {
+        Vector c;
+        no = readRecords(file, 8, record, c);
+        if (no >= 3) recentre(record, 8, no, c);
+        return no >= 3;
+    }
+    void complete(bool loaded) {
+        if (loaded)
+            owner->build(record, no);
+        else
+            owner->loaded(nullptr);
+    }
+    void Delete() const { delete this; }
+};
+
+// WeldJob welds the records into a list that no other part of the framework
+// can reach on a worker thread and hands the list to the AsyncGraphic at a
+// frame boundary
+//
+class WeldJob : public iAssetJob {
+
+    AsyncGraphic*              owner;  // graphic that requested the list
+    IndexedVertexList<Vertex>* list;   // list being built - owned by the job
+    std::vector<float>         record; // x y z nx ny nz tu tv records
+
+    WeldJob(const WeldJob&);
+    WeldJob& operator=(const WeldJob&);
+    virtual ~WeldJob() { if (list) list->Delete(); }
+
+  public:
+    WeldJob(AsyncGraphic* o, IndexedVertexList<Vertex>* l, 
+     std::vector<float>& r) : owner(o), list(l) { record.swap(r); }
+    bool load() {
+        unsigned no = record.size() / 8;
+        for (unsigned i = 0; i < no; i++) {
+            const float* r = &record[i * 8];
+            list->add(Vertex(Vector(r[0], r[1], r[2]), 
+                Vector(r[3], r[4], r[5]), r[6], r[7]));
+        }
+        list->optimize();
+        return true;
+    }
+    void complete(bool) {
+        owner->loaded(list);
+        list = nullptr;
+    }
+    void Delete() const { delete this; }
+};
+
+// LoadTriangleList creates an AsyncGraphic that draws a unit box until the
+// triangle list in file has been read and welded on the worker threads
+// with the specified priority
+//
+iGraphic* LoadTriangleList(const wchar_t* file, int priority) {
+
+    AsyncGraphic* graphic = new AsyncGraphic(priority);
+    if (file) {
+        int len = strlen(file);
+        wchar_t* f = new wchar_t[len + 1];
+        strcpy(f, file, len);
+        graphic->request(new RecordJob(graphic, f));
+    }
+
+    return graphic;
+}
+
+// constructor creates the placeholder box and withdraws it from the
+// coordinator
+//
+AsyncGraphic::AsyncGraphic(int p) : graphic(nullptr), handle(0), 
+ priority(p) {
+
+    placeholder = CreateBox(-0.5f, -0.5f, -0.5f, 0.5f, 0.5f, 0.5f);
+    coordinator->remove(placeholder);
+}
+
+// request queues job on behalf of the graphic
+//
+void AsyncGraphic::request(iAssetJob* job) {
+
+    handle = loader->request(job, priority);
+}
+
+// build creates an empty list for the no records, withdraws it from the
+// coordinator and queues the job that fills it
+//
+void AsyncGraphic::build(std::vector<float>& record, unsigned no) {
+
+    IndexedVertexList<Vertex>* list = (IndexedVertexList<Vertex>*)
+     CreateIndexedVertexList<Vertex>(TRIANGLE_LIST, no / 3);
+    coordinator->remove((iGraphic*)list);
+    request(new WeldJob(this, list, record));
+}
+
+// loaded replaces the placeholder with graphic g - keeps the placeholder if
+// g is nullptr
+//
+void AsyncGraphic::loaded(iGraphic* g) {
+
+    handle = 0;
+    if (g) {
+        if (graphic) graphic->Delete();
+        graphic = g;
+    }
+}
+
+// suspend suspends the graphics that the AsyncGraphic owns
+//
+void AsyncGraphic::suspend() {
+
+    placeholder->suspend();
+    if (graphic) graphic->suspend();
+}
+
+// release releases the graphics that the AsyncGraphic owns
+//
+void AsyncGraphic::release() {
+
+    placeholder->release();
+    if (graphic) graphic->release();
+}
+
+// destructor withdraws the pending request and deletes the graphics
+//
+AsyncGraphic::~AsyncGraphic() {
+
+    if (handle && loader)
+        loader->cancel(handle);
+    placeholder->Delete();
+    if (graphic) graphic->Delete();
+}
+
+void add(IndexedVertexList<Vertex>* vertexList, const Vector& p1, 
+ const Vector& p2, const Vector& p3, const Vector& p4, const Vector& n) {
+
+    vertexList->add(Vertex(p1, n, 1, 0));
+    vertexList->add(Vertex(p2, n, 0, 0));
+    vertexList->add(Vertex(p3, n, 0, 1));
+    vertexList->add(Vertex(p1, n, 1, 0));
+    vertexList->add(Vertex(p3, n, 0, 1));
+    vertexList->add(Vertex(p4, n, 1, 1));
+}
+
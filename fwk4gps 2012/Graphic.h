@@ -1,80 +1,132 @@
-#ifndef _GRAPHIC_H_
-#define _GRAPHIC_H_
-
-/* Graphic and Vertex Definitions - Modelling Layer
- *
- * Graphic.h
- * fwk4gps version 3.0
- * gam666/dps901/gam670/dps905
- * January 14 2012
- * copyright (c) 2012 Chris Szalwinski 
- * distributed under TPL - see ../Licenses.txt
- */
-
-#include "iGraphic.h"         // for the Graphic Interface
-#include "MathDeclarations.h" // for Colour
-
-//-------------------------------- LitVertex ----------------------------------
-//
-// The LitVertex class defines the structure for a single coloured vertex
-//
-class LitVertex {
-
-    float  x; // x coordinate in the local frame
-    float  y; // y coordinate in the local frame
-    float  z; // z coordinate in the local frame
-    Colour c; // colour
-    static unsigned size;
-    static unsigned format;
-
-  public:
-    static unsigned vertexSize()   { return size; }
-    static unsigned vertexFormat() { return format; }
-    LitVertex();
-    LitVertex(const Vector&, const Colour&, float = 0, float = 0);
-    void   populate(void**) const;
-    Vector position() const;
-};
-
-//-------------------------------- Vertex -------------------------------------
-//
-// The Vertex class defines the structure for a single vertex
-//
-class Vertex {
-
-    float x;   // x coordinate in the local frame
-    float y;   // y coordinate in the local frame
-    float z;   // z coordinate in the local frame
-    float nx;  // x coordinate of normal in the local frame
-    float ny;  // y coordinate of normal in the local frame
-    float nz;  // z coordinate of normal in the local frame
-    float tu;  // u coordinate of texture
-    float tv;  // v coordinate of texture
-    static unsigned size;
-    static unsigned format;
-
-  public:
-    static unsigned vertexSize()   { return size; }
-    static unsigned vertexFormat() { return format; }
-    Vertex();
-    Vertex(const Vector&, const Vector&, float = 0, float = 0);
-    void   populate(void**) const;
-    Vector position() const;
-};
-
-//-------------------------------- Graphic ------------------------------------
-//
-// The Graphic class defines the structure of the graphic representations
-//
-class iAPIGraphic;
-
-class Graphic : public iGraphic {
-
-protected:
-    
-    Graphic();
-    Graphic(const Graphic&);
-    virtual ~Graphic();
-};
-
-#endif
+#ifndef _GRAPHIC_H_
+#define _GRAPHIC_H_
+
+/* Graphic and Vertex Definitions - Modelling Layer
+ *
+ * Graphic.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <type_traits>         // for is_standard_layout
+#include "iGraphic.h"         // for the Graphic Interface
+#include "MathDeclarations.h" // for Colour
+
+// vertex sizes in bytes - each vertex class stores its data in the layout
+// of its device format so that a vertex list uploads with a single copy
+//
+#define VERTEX_SIZE        32
+#define LIT_VERTEX_SIZE    16
+#define SPRITE_VERTEX_SIZE 24
+
+//-------------------------------- LitVertex ----------------------------------
+//
+// The LitVertex class defines the structure for a single coloured vertex
+//
+class LitVertex {
+
+    float    x; // x coordinate in the local frame
+    float    y; // y coordinate in the local frame
+    float    z; // z coordinate in the local frame
+    unsigned c; // colour packed as ARGB
+    static unsigned size;
+    static unsigned format;
+
+  public:
+    static unsigned vertexSize()   { return size; }
+    static unsigned vertexFormat() { return format; }
+    LitVertex();
+    LitVertex(const Vector&, const Colour&, float = 0, float = 0);
+    Vector position() const;
+    void   transform(const Matrix& world, const Matrix& normals);
+};
+
+//-------------------------------- Vertex -------------------------------------
+//
+// The Vertex class defines the structure for a single vertex
+//
+class Vertex {
+
+    float x;   // x coordinate in the local frame
+    float y;   // y coordinate in the local frame
+    float z;   // z coordinate in the local frame
+    float nx;  // x coordinate of normal in the local frame
+    float ny;  // y coordinate of normal in the local frame
+    float nz;  // z coordinate of normal in the local frame
+    float tu;  // u coordinate of texture
+    float tv;  // v coordinate of texture
+    static unsigned size;
+    static unsigned format;
+
+  public:
+    static unsigned vertexSize()   { return size; }
+    static unsigned vertexFormat() { return format; }
+    Vertex();
+    Vertex(const Vector&, const Vector&, float = 0, float = 0);
+    Vector position() const;
+    void   transform(const Matrix& world, const Matrix& normals);
+};
+
+//-------------------------------- SpriteVertex -------------------------------
+//
+// The SpriteVertex class defines the structure for a single corner of a
+// coloured, textured billboard - its position is already in world space
+// and its constructor is inline because particle systems write millions 
+// of them each frame
+//
+class SpriteVertex {
+
+    float    x;  // x coordinate in world space
+    float    y;  // y coordinate in world space
+    float    z;  // z coordinate in world space
+    unsigned c;  // colour packed as ARGB
+    float    tu; // u coordinate of texture
+    float    tv; // v coordinate of texture
+    static unsigned size;
+    static unsigned format;
+
+  public:
+    static unsigned vertexSize()   { return size; }
+    static unsigned vertexFormat() { return format; }
+    SpriteVertex() : x(0), y(0), z(0), c(0), tu(0), tv(0) {}
+    SpriteVertex(float xx, float yy, float zz, unsigned cc, float u, 
+     float v) : x(xx), y(yy), z(zz), c(cc), tu(u), tv(v) {}
+};
+
+// the device copies the vertex arrays byte for byte
+static_assert(std::is_standard_layout<Vertex>::value &&
+ sizeof(Vertex) == VERTEX_SIZE, "Vertex does not match its device format");
+static_assert(std::is_standard_layout<LitVertex>::value &&
+ sizeof(LitVertex) == LIT_VERTEX_SIZE, 
+ "LitVertex does not match its device format");
+static_assert(std::is_standard_layout<SpriteVertex>::value &&
+ sizeof(SpriteVertex) == SPRITE_VERTEX_SIZE, 
+ "SpriteVertex does not match its device format");
+
+//-------------------------------- Graphic ------------------------------------
+//
+// The Graphic class defines the structure of the graphic representations
+//
+class iAPIGraphic;
+
+class Graphic : public iGraphic {
+
+    mutable float  radius;  // radius of the cached bounding sphere
+    mutable Vector centre;  // centre of the cached bounding sphere
+    mutable Vector minimum; // minimum corner of the cached bounding box
+    mutable Vector maximum; // maximum corner of the cached bounding box
+
+protected:
+    mutable bool   bounded; // the cached bounds are current
+
+    Graphic();
+    Graphic(const Graphic&);
+    virtual ~Graphic();
+    float bounds(const void* vertex, unsigned stride, unsigned n, 
+     Vector& min, Vector& max, Vector& c) const;
+};
+
+#endif
@@ -0,0 +1,711 @@
+/* Mesh Importer Implementation - Modelling Layer
+ *
+ * Importer.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <climits>            // for UINT_MAX
+#include <cstdio>             // for fopen, fread, setvbuf
+#include <cstring>            // for memcmp, memcpy
+#include <vector>
+#include "Graphic.h"          // for Vertex
+#include "IndexedVertexList.h" // for the IndexedVertexList template
+#include "FloatReader.h"      // for the FloatReader class definition
+#include "Workers.h"          // for the Workers class definition
+#include "iUtilities.h"       // for nameWithDir()
+#include "MathDefinitions.h"  // for cross, normal
+#include "ModellingLayer.h"   // for ASSET_DIRECTORY
+
+#define IMPORT_CHUNK     65536 // triangles converted at a time
+#define IMPORT_MIN_SLICE 4096  // fewest triangles converted by one thread
+#define NO_ATTRIBUTE     (~0u) // corner has no normal or texture coordinate
+
+//-------------------------------- MeshBuilder --------------------------------
+//
+// The MeshBuilder class collects the triangles of an imported mesh in
+// fixed-size chunks of corners, converts each chunk to vertices - on the
+// shared workers if more than one thread is requested - and welds them
+// into an indexed list
+//
+struct Corner {
+    unsigned p; // position index
+    unsigned n; // normal index or NO_ATTRIBUTE
+    unsigned t; // texture coordinate index or NO_ATTRIBUTE
+};
+
+class MeshBuilder {
+
+    std::vector<Vector>        position; // positions read from the file
+    std::vector<Vector>        normal;   // normals read from the file
+    std::vector<float>         texture;  // u v pairs read from the file
+    std::vector<Corner>        corner;   // corners of the current chunk
+    std::vector<Vertex>        vertex;   // vertices of the current chunk
+    IndexedVertexList<Vertex>* list;     // list being built
+    unsigned                   threads;  // threads converting each chunk
+    Workers*                   workers;  // shared workers - nullptr if none
+    unsigned                   nTriangles; // triangles expected
+    unsigned                   added;    // triangles added so far
+    bool                       invalid;  // an index was out of range
+
+    MeshBuilder(const MeshBuilder&);
+    MeshBuilder& operator=(const MeshBuilder&);
+    static void convert(void* b, unsigned first, unsigned last, void* bad);
+    void flush();
+
+  public:
+    MeshBuilder(unsigned t);
+    ~MeshBuilder();
+    void reserve(unsigned np, unsigned nn, unsigned nt);
+    void addPosition(float x, float y, float z) {
+        position.push_back(Vector(x, y, z));
+    }
+    void addNormal(float x, float y, float z) {
+        normal.push_back(Vector(x, y, z));
+    }
+    void addTexture(float u, float v) {
+        texture.push_back(u);
+        texture.push_back(v);
+    }
+    unsigned noPositions() const        { return position.size(); }
+    unsigned noNormals() const          { return normal.size(); }
+    unsigned noTextures() const         { return texture.size() / 2; }
+    void begin(unsigned nt);
+    void triangle(const Corner& a, const Corner& b, const Corner& c);
+    iGraphic* end();
+};
+
+// constructor attaches the builder to the shared workers if more than one
+// thread is to convert each chunk
+//
+MeshBuilder::MeshBuilder(unsigned t) : list(nullptr), threads(t ? t : 1),
+ workers(nullptr), nTriangles(0), added(0), invalid(false) {
+
+    if (threads > 1) workers = AttachWorkers();
+}
+
+// destructor deletes any unfinished list and detaches from the workers
+//
+MeshBuilder::~MeshBuilder() {
+
+    if (list) list->Delete();
+    if (workers) DetachWorkers();
+}
+
+// reserve sets aside space for the attributes to be read
+//
+void MeshBuilder::reserve(unsigned np, unsigned nn, unsigned nt) {
+
+    position.reserve(np);
+    normal.reserve(nn);
+    texture.reserve(2 * nt);
+}
+
+// begin creates the list for nt triangles
+//
+void MeshBuilder::begin(unsigned nt) {
+
+    nTriangles = nt;
+    added      = 0;
+    if (list) list->Delete();
+    list = nt ? (IndexedVertexList<Vertex>*)
+     CreateIndexedVertexList<Vertex>(TRIANGLE_LIST, nt) : nullptr;
+    corner.reserve(3 * IMPORT_CHUNK);
+    vertex.resize(3 * IMPORT_CHUNK);
+}
+
+// triangle adds the triangle with corners a, b, c to the current chunk
+//
+void MeshBuilder::triangle(const Corner& a, const Corner& b,
+ const Corner& c) {
+
+    if (!list || added + corner.size() / 3 >= nTriangles) return;
+
+    corner.push_back(a);
+    corner.push_back(b);
+    corner.push_back(c);
+    if (corner.size() == 3 * IMPORT_CHUNK)
+        flush();
+}
+
+// convert converts triangles [first, last) of the current chunk of builder
+// item to vertices - corners without normals receive the face normal, which
+// is zero for a degenerate face - sets the char at bad if an index is out
+// of range
+//
+void MeshBuilder::convert(void* item, unsigned first, unsigned last,
+ void* bad) {
+
+    MeshBuilder* b = (MeshBuilder*)item;
+    unsigned np = b->position.size(), nn = b->normal.size(),
+     nt = b->texture.size() / 2;
+
+    for (unsigned t = first; t < last; t++) {
+        const Corner* c = &b->corner[3 * t];
+        if (c[0].p >= np || c[1].p >= np || c[2].p >= np) {
+            *(char*)bad = 1;
+            continue;
+        }
+        const Vector& p0 = b->position[c[0].p];
+        Vector face = cross(b->position[c[1].p] - p0,
+         b->position[c[2].p] - p0);
+        float  area = face.length();
+        face = area > 1e-30f ? face / area : Vector(0, 0, 0);
+        for (unsigned k = 0; k < 3; k++) {
+            Vector n = c[k].n < nn ? b->normal[c[k].n] : face;
+            float  u = 0, v = 0;
+            if (c[k].t < nt) {
+                u = b->texture[2 * c[k].t];
+                v = b->texture[2 * c[k].t + 1];
+            }
+            b->vertex[3 * t + k] = Vertex(b->position[c[k].p], n, u, v);
+        }
+    }
+}
+
+// flush converts the current chunk and welds its vertices into the list
+//
+void MeshBuilder::flush() {
+
+    unsigned n = corner.size() / 3;
+    if (!n) return;
+
+    unsigned nThreads = threads;
+    if (nThreads > n / IMPORT_MIN_SLICE) nThreads = n / IMPORT_MIN_SLICE;
+    if (nThreads < 1) nThreads = 1;
+    std::vector<char> bad(nThreads, 0);
+    if (nThreads > 1) {
+        std::vector<WorkerTask> task;
+        slice(task, convert, this, n, (n + nThreads - 1) / nThreads, nullptr);
+        for (unsigned i = 0; i < task.size(); i++)
+            task[i].out = &bad[i];
+        workers->run(task);
+    }
+    else
+        convert(this, 0, n, &bad[0]);
+    for (unsigned i = 0; i < nThreads; i++)
+        if (bad[i]) invalid = true;
+
+    for (unsigned i = 0; i < 3 * n; i++)
+        list->add(vertex[i]);
+    added += n;
+    corner.clear();
+}
+
+// end flushes the last chunk and returns the optimized list - nullptr if
+// any index was out of range or the list is incomplete
+//
+iGraphic* MeshBuilder::end() {
+
+    flush();
+    iGraphic* graphic = nullptr;
+    if (list && !invalid && added == nTriangles) {
+        list->optimize();
+        graphic = list;
+        list    = nullptr;
+    }
+
+    return graphic;
+}
+
+//-------------------------------- OBJ ----------------------------------------
+//
+// token returns the next whitespace-delimited token of [s, e) in [t, te)
+// and advances s past it - returns false if no token remains
+//
+static bool token(const char*& s, const char* e, const char*& t,
+ const char*& te) {
+
+    while (s < e && (*s == ' ' || *s == '\t'))
+        s++;
+    if (s == e) return false;
+    t = s;
+    while (s < e && *s != ' ' && *s != '\t')
+        s++;
+    te = s;
+
+    return true;
+}
+
+// floats reads up to n numbers from [s, e) into f - returns the number read
+//
+static unsigned floats(const char* s, const char* e, float* f, unsigned n) {
+
+    const char *t, *te;
+    unsigned i = 0;
+    while (i < n && token(s, e, t, te) && parseFloat(t, te, f[i]))
+        i++;
+
+    return i;
+}
+
+// objIndex converts a 1-based or negative relative index in [s, e) to a
+// 0-based index into a list of count items - NO_ATTRIBUTE if empty or bad
+//
+static unsigned objIndex(const char* s, const char* e, unsigned count) {
+
+    bool negative = s < e && *s == '-';
+    if (negative) s++;
+    if (s == e) return NO_ATTRIBUTE;
+    unsigned i = 0;
+    for (; s < e && *s >= '0' && *s <= '9'; s++)
+        i = i * 10 + (*s - '0');
+    if (s != e || !i) return NO_ATTRIBUTE;
+
+    return negative ? (i <= count ? count - i : NO_ATTRIBUTE) : i - 1;
+}
+
+// objCorner converts a p, p/t, p//n or p/t/n face token to a corner
+//
+static Corner objCorner(const char* s, const char* e, const MeshBuilder& b) {
+
+    Corner c = { NO_ATTRIBUTE, NO_ATTRIBUTE, NO_ATTRIBUTE };
+    const char* a[3] = { s, e, e };
+    const char* z[3] = { e, e, e };
+    unsigned k = 0;
+    for (const char* q = s; q < e; q++)
+        if (*q == '/' && k < 2) {
+            z[k]     = q;
+            a[++k]   = q + 1;
+        }
+    c.p = objIndex(a[0], z[0], b.noPositions());
+    if (k >= 1) c.t = objIndex(a[1], z[1], b.noTextures());
+    if (k >= 2) c.n = objIndex(a[2], z[2], b.noNormals());
+
+    return c;
+}
+
+// ObjMesh imports the positions, normals, texture coordinates and faces of
+// all groups in a Wavefront OBJ file into one indexed triangle list - faces
+// with more than three corners are triangulated as fans - the first pass
+// counts the attributes and triangles, the second converts the faces in
+// chunks on threads threads - returns nullptr if the file cannot be read
+//
+iGraphic* ObjMesh(const wchar_t* file, unsigned threads) {
+
+	// construct filename with path
+	int len = strlen(file) + strlen(ASSET_DIRECTORY) + 1;
+	wchar_t* absFile = new wchar_t[len + 1];
+	nameWithDir(absFile, ASSET_DIRECTORY, file, len);
+
+    FloatReader in(absFile);
+    delete [] absFile;
+    if (!in.isOpen()) return nullptr;
+
+    // first pass - count the attributes and the triangles
+    unsigned np = 0, nn = 0, nt = 0, nTriangles = 0;
+    const char *s, *e, *t, *te;
+    while (in.readLine(s, e)) {
+        if (!token(s, e, t, te)) continue;
+        unsigned n = te - t;
+        if (n == 1 && *t == 'v') np++;
+        else if (n == 2 && t[0] == 'v' && t[1] == 'n') nn++;
+        else if (n == 2 && t[0] == 'v' && t[1] == 't') nt++;
+        else if (n == 1 && *t == 'f') {
+            unsigned corners = 0;
+            while (token(s, e, t, te))
+                corners++;
+            if (corners >= 3) nTriangles += corners - 2;
+        }
+    }
+    if (!nTriangles) return nullptr;
+
+    // second pass - read the attributes and convert the faces in chunks
+    MeshBuilder builder(threads);
+    builder.reserve(np, nn, nt);
+    builder.begin(nTriangles);
+    in.rewind();
+    while (in.readLine(s, e)) {
+        if (!token(s, e, t, te)) continue;
+        unsigned n = te - t;
+        float f[3] = { 0, 0, 0 };
+        if (n == 1 && *t == 'v') {
+            floats(s, e, f, 3);
+            builder.addPosition(f[0], f[1], f[2]);
+        }
+        else if (n == 2 && t[0] == 'v' && t[1] == 'n') {
+            floats(s, e, f, 3);
+            builder.addNormal(f[0], f[1], f[2]);
+        }
+        else if (n == 2 && t[0] == 'v' && t[1] == 't') {
+            floats(s, e, f, 2);
+            builder.addTexture(f[0], f[1]);
+        }
+        else if (n == 1 && *t == 'f') {
+            Corner first, last, c;
+            unsigned corners = 0;
+            while (token(s, e, t, te)) {
+                c = objCorner(t, te, builder);
+                if (corners == 0)
+                    first = c;
+                else if (corners >= 2)
+                    builder.triangle(first, last, c);
+                last = c;
+                corners++;
+            }
+        }
+        // g, o, s, usemtl and mtllib lines do not affect the geometry
+    }
+
+    return builder.end();
+}
+
+//-------------------------------- PLY ----------------------------------------
+//
+// PLY property types
+//
+enum PlyType { PLY_NONE, PLY_INT8, PLY_UINT8, PLY_INT16, PLY_UINT16,
+ PLY_INT32, PLY_UINT32, PLY_FLOAT32, PLY_FLOAT64 };
+
+struct PlyProperty {
+    PlyType  type;      // type of the value - or of the list items
+    PlyType  countType; // type of the list count - PLY_NONE if not a list
+    int      slot;      // x y z nx ny nz u v - 0 to 7 - -1 if unused
+};
+
+struct PlyElement {
+    char     name[32];
+    unsigned count;
+    std::vector<PlyProperty> property;
+};
+
+// plyType converts the type name in [s, e) to a PlyType
+//
+static PlyType plyType(const char* s, const char* e) {
+
+    static const struct { const char* name; PlyType type; } table[] = {
+     { "char", PLY_INT8 }, { "int8", PLY_INT8 }, { "uchar", PLY_UINT8 },
+     { "uint8", PLY_UINT8 }, { "short", PLY_INT16 }, { "int16", PLY_INT16 },
+     { "ushort", PLY_UINT16 }, { "uint16", PLY_UINT16 },
+     { "int", PLY_INT32 }, { "int32", PLY_INT32 }, { "uint", PLY_UINT32 },
+     { "uint32", PLY_UINT32 }, { "float", PLY_FLOAT32 },
+     { "float32", PLY_FLOAT32 }, { "double", PLY_FLOAT64 },
+     { "float64", PLY_FLOAT64 } };
+
+    unsigned n = e - s;
+    for (unsigned i = 0; i < sizeof table / sizeof table[0]; i++)
+        if (strlen(table[i].name) == n && !memcmp(table[i].name, s, n))
+            return table[i].type;
+
+    return PLY_NONE;
+}
+
+// plySize returns the size in bytes of type t
+//
+static unsigned plySize(PlyType t) {
+
+    switch (t) {
+        case PLY_INT8:  case PLY_UINT8:   return 1;
+        case PLY_INT16: case PLY_UINT16:  return 2;
+        case PLY_INT32: case PLY_UINT32: case PLY_FLOAT32: return 4;
+        case PLY_FLOAT64:                 return 8;
+        default:                          return 0;
+    }
+}
+
+// plyValue converts the little-endian value of type t at b to a double
+//
+static double plyValue(const unsigned char* b, PlyType t) {
+
+    double v = 0;
+    switch (t) {
+        case PLY_INT8:   v = (signed char)b[0]; break;
+        case PLY_UINT8:  v = b[0]; break;
+        case PLY_INT16:  v = (short)(b[0] | b[1] << 8); break;
+        case PLY_UINT16: v = (unsigned short)(b[0] | b[1] << 8); break;
+        case PLY_INT32:
+            v = (int)(b[0] | b[1] << 8 | b[2] << 16 | (unsigned)b[3] << 24);
+            break;
+        case PLY_UINT32:
+            v = (unsigned)(b[0] | b[1] << 8 | b[2] << 16 |
+             (unsigned)b[3] << 24);
+            break;
+        case PLY_FLOAT32: {
+            unsigned u = b[0] | b[1] << 8 | b[2] << 16 | (unsigned)b[3] << 24;
+            float f;
+            memcpy(&f, &u, 4);
+            v = f;
+            break;
+        }
+        case PLY_FLOAT64: {
+            unsigned long long u = 0;
+            for (int i = 7; i >= 0; i--)
+                u = u << 8 | b[i];
+            memcpy(&v, &u, 8);
+            break;
+        }
+        default: break;
+    }
+
+    return v;
+}
+
+// plySlot identifies the vertex attribute held by the property named [s, e)
+//
+static int plySlot(const char* s, const char* e) {
+
+    static const char* name[] = { "x", "y", "z", "nx", "ny", "nz", "u", "v",
+     "s", "t", "texture_u", "texture_v" };
+    static const int slot[] = { 0, 1, 2, 3, 4, 5, 6, 7, 6, 7, 6, 7 };
+
+    unsigned n = e - s;
+    for (unsigned i = 0; i < sizeof slot / sizeof slot[0]; i++)
+        if (strlen(name[i]) == n && !memcmp(name[i], s, n))
+            return slot[i];
+
+    return -1;
+}
+
+// tell returns the position in fp and seek moves it - both take 64-bit
+// offsets so that files larger than 2GB can be read
+//
+static long long tell(FILE* fp) {
+
+    #ifdef _MSC_VER
+    return _ftelli64(fp);
+    #else
+    return ftello(fp);
+    #endif
+}
+
+static bool seek(FILE* fp, long long offset, int origin) {
+
+    #ifdef _MSC_VER
+    return !_fseeki64(fp, offset, origin);
+    #else
+    return !fseeko(fp, offset, origin);
+    #endif
+}
+
+// readValue reads one value of type t from fp
+//
+static bool readValue(FILE* fp, PlyType t, double& v) {
+
+    unsigned char b[8];
+    unsigned n = plySize(t);
+    if (!n || fread(b, 1, n, fp) != n) return false;
+    v = plyValue(b, t);
+
+    return true;
+}
+
+// readCount reads the number n of values in property p - 1 unless p is a
+// list - and sets size to their number of bytes - returns false if the
+// count is negative or the values would not fit in memory
+//
+static bool readCount(FILE* fp, const PlyProperty& p, unsigned& n,
+ unsigned& size) {
+
+    double count = 1;
+    if (p.countType != PLY_NONE && !readValue(fp, p.countType, count))
+        return false;
+    unsigned s = plySize(p.type);
+    if (!(count >= 0 && count <= UINT_MAX) ||
+     (s && (unsigned)count > UINT_MAX / s))
+        return false;
+    n    = (unsigned)count;
+    size = n * s;
+
+    return true;
+}
+
+// skipElement reads past the items of element el
+//
+static bool skipElement(FILE* fp, const PlyElement& el) {
+
+    for (unsigned i = 0; i < el.count; i++)
+        for (unsigned k = 0; k < el.property.size(); k++) {
+            unsigned n, size;
+            if (!readCount(fp, el.property[k], n, size) ||
+             (size && !seek(fp, size, SEEK_CUR)))
+                return false;
+        }
+
+    return true;
+}
+
+// readFaces reads the faces of element el - counts the triangles in
+// nTriangles if builder is nullptr, otherwise adds them to builder
+//
+static bool readFaces(FILE* fp, const PlyElement& el, unsigned& nTriangles,
+ MeshBuilder* builder) {
+
+    std::vector<unsigned char> item;
+    for (unsigned i = 0; i < el.count; i++)
+        for (unsigned k = 0; k < el.property.size(); k++) {
+            const PlyProperty& p = el.property[k];
+            unsigned n, size;
+            if (!readCount(fp, p, n, size)) return false;
+            if (p.slot != 8) {
+                if (size && !seek(fp, size, SEEK_CUR)) return false;
+                continue;
+            }
+            if (!builder) {
+                if (size && !seek(fp, size, SEEK_CUR)) return false;
+                if (n >= 3) nTriangles += n - 2;
+                continue;
+            }
+            item.resize(size ? size : 1);
+            if (size && fread(&item[0], 1, size, fp) != size) return false;
+            Corner first, last, c;
+            for (unsigned j = 0; j < n; j++) {
+                c.p = (unsigned)plyValue(&item[j * plySize(p.type)], p.type);
+                c.n = c.t = c.p;
+                if (j == 0)
+                    first = c;
+                else if (j >= 2)
+                    builder->triangle(first, last, c);
+                last = c;
+            }
+        }
+
+    return true;
+}
+
+// PlyMesh imports the vertices and faces of a binary little-endian PLY
+// file into an indexed triangle list - vertices carry x y z and optionally
+// nx ny nz and u v (or s t) - faces with more than three corners are
+// triangulated as fans - the faces are read twice, once to count the
+// triangles and once to convert them in chunks on threads threads -
+// returns nullptr if the file cannot be read
+//
+iGraphic* PlyMesh(const wchar_t* file, unsigned threads) {
+
+	// construct filename with path
+	int len = strlen(file) + strlen(ASSET_DIRECTORY) + 1;
+	wchar_t* absFile = new wchar_t[len + 1];
+	nameWithDir(absFile, ASSET_DIRECTORY, file, len);
+
+    FILE* fp = nullptr;
+    #ifdef _MSC_VER
+    if (_wfopen_s(&fp, absFile, L"rb")) fp = nullptr;
+    #else
+    char name[FILENAME_MAX];
+    strcpyFromWC(name, absFile, FILENAME_MAX - 1);
+    fp = fopen(name, "rb");
+    #endif
+    delete [] absFile;
+    if (!fp) return nullptr;
+    setvbuf(fp, nullptr, _IOFBF, FLOAT_READER_BLOCK);
+
+    // header
+    std::vector<PlyElement> element;
+    char line[256];
+    bool binary = false, ok = fgets(line, sizeof line, fp) &&
+     !memcmp(line, "ply", 3);
+    while (ok && fgets(line, sizeof line, fp)) {
+        const char *s = line, *e = line + strlen(line), *t, *te;
+        while (e > s && (e[-1] == '\n' || e[-1] == '\r')) e--;
+        if (!token(s, e, t, te)) continue;
+        unsigned n = te - t;
+        if (n == 10 && !memcmp(t, "end_header", 10))
+            break;
+        else if (n == 6 && !memcmp(t, "format", 6))
+            binary = token(s, e, t, te) && te - t == 20 &&
+             !memcmp(t, "binary_little_endian", 20);
+        else if (n == 7 && !memcmp(t, "element", 7)) {
+            PlyElement el;
+            el.count = 0;
+            el.name[0] = '\0';
+            if (token(s, e, t, te)) {
+                unsigned k = te - t < 31 ? te - t : 31;
+                memcpy(el.name, t, k);
+                el.name[k] = '\0';
+            }
+            if (token(s, e, t, te))
+                for (; t < te && *t >= '0' && *t <= '9'; t++)
+                    el.count = el.count * 10 + (*t - '0');
+            element.push_back(el);
+        }
+        else if (n == 8 && !memcmp(t, "property", 8) && !element.empty()) {
+            PlyProperty p = { PLY_NONE, PLY_NONE, -1 };
+            t = te = e;
+            if (token(s, e, t, te) && te - t == 4 && !memcmp(t, "list", 4)) {
+                if (token(s, e, t, te)) p.countType = plyType(t, te);
+                ok = p.countType != PLY_NONE && p.countType != PLY_FLOAT32 &&
+                 p.countType != PLY_FLOAT64;
+                if (!token(s, e, t, te)) ok = false;
+            }
+            p.type = plyType(t, te);
+            if (p.type == PLY_NONE) ok = false;
+            if (token(s, e, t, te)) {
+                if (p.countType != PLY_NONE)
+                    p.slot = (te - t == 14 && !memcmp(t, "vertex_indices", 14))
+                     || (te - t == 12 && !memcmp(t, "vertex_index", 12)) ?
+                     8 : -1;
+                else
+                    p.slot = plySlot(t, te);
+            }
+            element.back().property.push_back(p);
+        }
+        // comment and obj_info lines are ignored
+    }
+
+    // locate the vertex and face elements
+    int vi = -1, fi = -1;
+    for (unsigned i = 0; i < element.size(); i++) {
+        if (!strcmp(element[i].name, "vertex") && vi < 0) vi = i;
+        else if (!strcmp(element[i].name, "face") && fi < 0) fi = i;
+    }
+    if (!ok || !binary || vi < 0 || fi < 0) {
+        fclose(fp);
+        return nullptr;
+    }
+
+    // vertex attributes present
+    bool slot[8] = { false };
+    for (unsigned k = 0; k < element[vi].property.size(); k++) {
+        const PlyProperty& p = element[vi].property[k];
+        if (p.countType == PLY_NONE && p.slot >= 0) slot[p.slot] = true;
+    }
+
+    MeshBuilder builder(threads);
+    unsigned nv = element[vi].count, nTriangles = 0;
+    builder.reserve(nv, slot[3] ? nv : 0, slot[6] ? nv : 0);
+
+    // elements in file order - faces are counted then rewound and read
+    long long faces = 0;
+    for (unsigned i = 0; ok && i < element.size(); i++) {
+        const PlyElement& el = element[i];
+        if ((int)i == vi) {
+            for (unsigned v = 0; ok && v < el.count; v++) {
+                double a[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+                for (unsigned k = 0; ok && k < el.property.size(); k++) {
+                    const PlyProperty& p = el.property[k];
+                    double value, count = 1;
+                    if (p.countType != PLY_NONE) {
+                        ok = readValue(fp, p.countType, count) && seek(fp,
+                         (long long)count * plySize(p.type), SEEK_CUR);
+                        continue;
+                    }
+                    ok = readValue(fp, p.type, value);
+                    if (p.slot >= 0) a[p.slot] = value;
+                }
+                builder.addPosition((float)a[0], (float)a[1], (float)a[2]);
+                if (slot[3])
+                    builder.addNormal((float)a[3], (float)a[4], (float)a[5]);
+                if (slot[6])
+                    builder.addTexture((float)a[6], (float)a[7]);
+            }
+        }
+        else if ((int)i == fi) {
+            faces = tell(fp);
+            ok = faces >= 0 && readFaces(fp, el, nTriangles, nullptr);
+        }
+        else
+            ok = skipElement(fp, el);
+    }
+
+    iGraphic* graphic = nullptr;
+    if (ok && nTriangles && seek(fp, faces, SEEK_SET)) {
+        builder.begin(nTriangles);
+        if (readFaces(fp, element[fi], nTriangles, &builder))
+            graphic = builder.end();
+    }
+    fclose(fp);
+
+    return graphic;
+}
@@ -0,0 +1,435 @@
+#ifndef _INDEXED_VERTEX_LIST_H_
+#define _INDEXED_VERTEX_LIST_H_
+
+/* Graphic Implementation - Modelling Layer
+ *
+ * IndexedVertexList.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <cstring>               // for memcmp, memcpy
+#include "Graphic.h"             // for Graphic class definition
+#include "iAPIGraphic.h"         // for the APIGraphic Interface
+#include "MeshOptimizer.h"       // for the mesh optimizer functions
+
+//-------------------------------- IndexedVertexList --------------------------
+//
+// The IndexedVertexList class defines the structure of a set of <T> vertices
+// that are referenced through a list of indices - add welds identical
+// vertices into a single stored vertex - a list and its clones share one
+// set of arrays and one API Primitive Set until one of them changes them
+//
+template <class T = Vertex>
+class IndexedVertexList : public Graphic {
+
+    struct Shared {
+        unsigned        refs;    // number of lists sharing the storage
+        T*              vertex;  // points to the array of vertices
+        unsigned*       indices; // points to the array of indices
+        unsigned*       bucket;  // weld table - vertex number + 1 or 0
+        iAPIGraphic*    api;     // points to the API Primitive Set
+        const iGraphic* user;    // list that the API Primitive Set reads
+    };
+
+    unsigned      maxNo;         // maximum number of vertices
+    unsigned      no;            // number of distinct vertices stored
+    unsigned      maxIndices;    // maximum number of indices
+    unsigned      nIndices;      // number of indices stored
+    unsigned      nBuckets;      // size of the weld table - a power of 2
+    Shared*       shared;        // points to the shared storage
+    PrimitiveType type;          // type of primitive
+    unsigned      nPrimitives;   // number of primitives
+
+    virtual ~IndexedVertexList()       { detach(); }
+    static unsigned hash(const T& v);
+    void   reweld();
+    void   bind();
+    void   detach();
+    void   unshare();
+
+  public:
+    IndexedVertexList(PrimitiveType, int);
+    IndexedVertexList(const IndexedVertexList& src);
+    IndexedVertexList& operator=(const IndexedVertexList&);
+    void*  clone() const               { return new IndexedVertexList(*this); }
+    int    add(const T& v);
+    bool   load(const void* v, unsigned nv, const void* i, unsigned ni,
+     unsigned indexSize);
+    void   optimize(bool overdraw = true, float* before = nullptr,
+     float* after = nullptr);
+    unsigned noVertices() const            { return no; }
+    const T* vertices() const {
+        return shared ? shared->vertex : nullptr;
+    }
+    void   upload(void* pv, unsigned n) const {
+        memcpy(pv, shared->vertex, n * sizeof(T));
+    }
+    Vector position(int i) const { return shared->vertex[i].position(); }
+    float  bounds(Vector& min, Vector& max, Vector& c) const {
+        return Graphic::bounds(shared ? shared->vertex : nullptr, sizeof(T),
+         no, min, max, c);
+    }
+    unsigned noIndices() const             { return nIndices; }
+    unsigned index(unsigned i) const       { return shared->indices[i]; }
+    bool   prepare() {
+        bind();
+        return shared->api->prepare(no);
+    }
+    void   render()                        { bind(); shared->api->draw(no); }
+    void   render(const Matrix* w, unsigned n) {
+        bind();
+        shared->api->draw(no, w, n);
+    }
+    unsigned  noPrimitives() const         { return nPrimitives; }
+    unsigned  batchKey() const;
+    iGraphic* merge(iGraphic* const* g, const Matrix* w, unsigned n) const;
+    iGraphic* simplify(float ratio) const;
+    void   suspend() {
+        if (shared) shared->api->suspend();
+    }
+    void   release() {
+        if (shared) shared->api->release();
+    }
+    void   Delete() const                  { delete this; }
+};
+
+// CreateIndexedVertexList creates an Indexed Vertex List object
+//
+template <class T>
+iGraphic* CreateIndexedVertexList(PrimitiveType t, int np) {
+
+    return new IndexedVertexList<T>(t, np);
+}
+
+// constructor allocates memory for the lists and the weld table and creates
+// the Translation
+//
+template <class T>
+IndexedVertexList<T>::IndexedVertexList(PrimitiveType t, int np) : no(0),
+ nIndices(0), type(t), nPrimitives(np > 0 ? np : 0) {
+
+    // Determine the number of indices for the Primitive Type
+    switch (t) {
+        case POINT_LIST:     maxIndices = nPrimitives;     break;
+        case LINE_LIST:      maxIndices = 2 * nPrimitives; break;
+        case LINE_STRIP:     maxIndices = nPrimitives + 1; break;
+        case TRIANGLE_LIST:  maxIndices = 3 * nPrimitives; break;
+        case TRIANGLE_STRIP: maxIndices = nPrimitives + 2; break;
+        case TRIANGLE_FAN:   maxIndices = nPrimitives + 1; break;
+        default: maxIndices = nPrimitives;
+    }
+    if (!nPrimitives) maxIndices = 0;
+    // no more distinct vertices than indices
+    maxNo    = maxIndices;
+    for (nBuckets = 1; nBuckets < 2 * maxNo; nBuckets <<= 1)
+        ;
+    shared          = new Shared;
+    shared->refs    = 1;
+    shared->vertex  = maxNo ? new T[maxNo] : 0;
+    shared->indices = maxIndices ? new unsigned[maxIndices] : 0;
+    shared->bucket  = new unsigned[nBuckets];
+    for (unsigned i = 0; i < nBuckets; i++)
+        shared->bucket[i] = 0;
+    shared->api     = CreateAPIVertexList(t, nPrimitives, T::vertexSize(),
+     T::vertexFormat(), (iGraphic*)this);
+    shared->user    = this;
+}
+
+// copy constructor initializes the storage pointer and calls the
+// assignment operator
+//
+template <class T>
+IndexedVertexList<T>::IndexedVertexList(const IndexedVertexList<T>& src) :
+ shared(nullptr) {
+
+    *this = src;
+}
+
+// assignment operator shares the storage of the source list - neither list
+// copies the arrays or the Translation until one of them changes
+//
+template <class T>
+IndexedVertexList<T>& IndexedVertexList<T>::operator=(
+ const IndexedVertexList<T>& src) {
+
+    if (this != &src) {
+        detach();
+        maxNo       = src.maxNo;
+        no          = src.no;
+        maxIndices  = src.maxIndices;
+        nIndices    = src.nIndices;
+        nBuckets    = src.nBuckets;
+        type        = src.type;
+        nPrimitives = src.nPrimitives;
+        shared      = src.shared;
+        bounded     = false;
+        if (shared) shared->refs++;
+    }
+
+    return *this;
+}
+
+// bind points the shared Translation at this list before a draw - the
+// Translation reads the vertices and indices from the list that draws it
+//
+template <class T>
+void IndexedVertexList<T>::bind() {
+
+    if (shared->user != this) {
+        shared->api->attach((iGraphic*)this);
+        shared->user = this;
+    }
+}
+
+// unshare gives the list its own copy of the shared arrays before the list
+// changes them - the other lists keep the originals and their buffers
+//
+template <class T>
+void IndexedVertexList<T>::unshare() {
+
+    if (shared->refs > 1) {
+        Shared* s  = new Shared;
+        s->refs    = 1;
+        s->vertex  = maxNo ? new T[maxNo] : 0;
+        for (unsigned i = 0; i < no; i++)
+            s->vertex[i] = shared->vertex[i];
+        s->indices = maxIndices ? new unsigned[maxIndices] : 0;
+        for (unsigned i = 0; i < nIndices; i++)
+            s->indices[i] = shared->indices[i];
+        s->bucket  = new unsigned[nBuckets];
+        for (unsigned i = 0; i < nBuckets; i++)
+            s->bucket[i] = shared->bucket[i];
+        s->api     = shared->api->clone();
+        s->api->attach((iGraphic*)this);
+        s->user    = this;
+        detach();
+        shared     = s;
+    }
+}
+
+// detach releases the list's share of the storage - the last list deletes
+// the arrays and the Translation
+//
+template <class T>
+void IndexedVertexList<T>::detach() {
+
+    if (shared) {
+        if (--shared->refs == 0) {
+            shared->api->Delete();
+            delete [] shared->vertex;
+            delete [] shared->indices;
+            delete [] shared->bucket;
+            delete shared;
+        }
+        else if (shared->user == this)
+            shared->user = nullptr;
+        shared = nullptr;
+    }
+}
+
+// hash returns the FNV-1a hash of the bytes of vertex v
+//
+template <class T>
+unsigned IndexedVertexList<T>::hash(const T& v) {
+
+    const unsigned char* b = (const unsigned char*)&v;
+    unsigned h = 2166136261u;
+    for (unsigned i = 0; i < sizeof(T); i++)
+        h = (h ^ b[i]) * 16777619u;
+    return h;
+}
+
+// add adds an index to vertex v, storing v only if an identical vertex has
+// not been stored already - returns the number of indices
+//
+template <class T>
+int IndexedVertexList<T>::add(const T& v) {
+
+    if (nIndices < maxIndices) {
+        unshare();
+        T*        vertex  = shared->vertex;
+        unsigned* indices = shared->indices;
+        unsigned* bucket  = shared->bucket;
+        // linear probing through the weld table
+        unsigned i = hash(v) & (nBuckets - 1);
+        while (bucket[i] && memcmp(&vertex[bucket[i] - 1], &v, sizeof(T)))
+            i = (i + 1) & (nBuckets - 1);
+        if (!bucket[i]) {
+            vertex[no++] = v;
+            bucket[i]    = no;
+            bounded      = false;
+        }
+        indices[nIndices++] = bucket[i] - 1;
+    }
+
+    return nIndices;
+}
+
+// load copies nv vertices from blob v and ni indices of indexSize bytes
+// from blob i without welding - the vertices in v have the layout of T -
+// returns false if the blobs exceed the capacity of the list or an index is
+// out of range
+//
+template <class T>
+bool IndexedVertexList<T>::load(const void* v, unsigned nv, const void* i,
+ unsigned ni, unsigned indexSize) {
+
+    if (nv > maxNo || ni > maxIndices) return false;
+
+    unshare();
+    unsigned* indices = shared->indices;
+    memcpy(shared->vertex, v, nv * sizeof(T));
+    no      = nv;
+    bounded = false;
+    if (indexSize == sizeof(unsigned))
+        memcpy(indices, i, ni * sizeof(unsigned));
+    else {
+        const unsigned short* s = (const unsigned short*)i;
+        for (unsigned k = 0; k < ni; k++)
+            indices[k] = s[k];
+    }
+    nIndices = ni;
+    for (unsigned k = 0; k < ni; k++)
+        if (indices[k] >= nv) {
+            no = nIndices = 0;
+            return false;
+        }
+    reweld();
+
+    return true;
+}
+
+// reweld rebuilds the weld table from the stored vertices
+//
+template <class T>
+void IndexedVertexList<T>::reweld() {
+
+    unsigned* bucket = shared->bucket;
+    for (unsigned i = 0; i < nBuckets; i++)
+        bucket[i] = 0;
+    for (unsigned k = 0; k < no; k++) {
+        unsigned i = hash(shared->vertex[k]) & (nBuckets - 1);
+        while (bucket[i])
+            i = (i + 1) & (nBuckets - 1);
+        bucket[i] = k + 1;
+    }
+}
+
+// optimize reorders a triangle list for the post-transform vertex cache,
+// optionally orders clusters of triangles to reduce overdraw, and renumbers
+// the vertices in order of first use - stores the ACMR before and after in
+// *before and *after if requested
+//
+template <class T>
+void IndexedVertexList<T>::optimize(bool overdraw, float* before,
+ float* after) {
+
+    if (before) *before = acmr(shared->indices, nIndices);
+    if (type == TRIANGLE_LIST && nIndices >= 6 && no) {
+        unshare();
+        T*        vertex  = shared->vertex;
+        unsigned* indices = shared->indices;
+        optimizeVertexCache(indices, nIndices, no);
+        if (overdraw) {
+            Vector* p = new Vector[no];
+            for (unsigned i = 0; i < no; i++)
+                p[i] = vertex[i].position();
+            optimizeOverdraw(indices, nIndices, &p[0].x, sizeof(Vector), no);
+            delete [] p;
+        }
+        unsigned* remap = new unsigned[no];
+        optimizeVertexFetch(indices, nIndices, no, remap);
+        T* v = new T[maxNo];
+        for (unsigned i = 0; i < no; i++)
+            v[remap[i]] = vertex[i];
+        delete [] remap;
+        delete [] vertex;
+        shared->vertex = v;
+        reweld();
+    }
+    if (after) *after = acmr(shared->indices, nIndices);
+}
+
+// batchKey identifies the indexed lists that can be merged with this one -
+// lists of the same vertex type and primitive type - 0 if the primitives
+// are connected and cannot be merged
+//
+template <class T>
+unsigned IndexedVertexList<T>::batchKey() const {
+
+    return type == POINT_LIST || type == LINE_LIST || type == TRIANGLE_LIST ?
+     0x80000000u | T::vertexFormat() << 3 | type : 0;
+}
+
+// merge creates an indexed list that holds the vertices of the n lists g[i]
+// transformed by w[i] - returns nullptr if any list cannot be merged with
+// this one
+//
+template <class T>
+iGraphic* IndexedVertexList<T>::merge(iGraphic* const* g, const Matrix* w,
+ unsigned n) const {
+
+    unsigned key = batchKey(), np = 0;
+
+    if (!key) return nullptr;
+    for (unsigned i = 0; i < n; i++) {
+        if (!g[i] || g[i]->batchKey() != key)
+            return nullptr;
+        np += ((const IndexedVertexList<T>*)g[i])->nPrimitives;
+    }
+
+    IndexedVertexList<T>* batch = new IndexedVertexList<T>(type, np);
+    for (unsigned i = 0; i < n; i++) {
+        const IndexedVertexList<T>* src = (const IndexedVertexList<T>*)g[i];
+        Matrix normals = normalTransform(w[i]);
+        for (unsigned k = 0; k < src->nIndices; k++) {
+            T v = src->shared->vertex[src->shared->indices[k]];
+            v.transform(w[i], normals);
+            batch->add(v);
+        }
+    }
+    batch->optimize();
+
+    return batch;
+}
+
+// simplify creates an indexed triangle list that approximates this one
+// with about ratio of its triangles - collapses edges in order of quadric
+// error, keeping open boundaries and seams fixed - returns nullptr if this
+// list is not a triangle list or cannot be reduced
+//
+template <class T>
+iGraphic* IndexedVertexList<T>::simplify(float ratio) const {
+
+    if (type != TRIANGLE_LIST || !no || nIndices < 6 || ratio <= 0 ||
+     ratio >= 1)
+        return nullptr;
+
+    const T*  vertex = shared->vertex;
+    unsigned* index  = new unsigned[nIndices];
+    memcpy(index, shared->indices, nIndices * sizeof(unsigned));
+    Vector* p = new Vector[no];
+    for (unsigned i = 0; i < no; i++)
+        p[i] = vertex[i].position();
+    unsigned target = (unsigned)(nIndices / 3 * ratio) * 3;
+    unsigned n = ::simplify(index, nIndices, &p[0].x, sizeof(Vector), no,
+     target > 3 ? target : 3);
+    delete [] p;
+
+    IndexedVertexList<T>* lod = nullptr;
+    if (n && n < nIndices) {
+        lod = new IndexedVertexList<T>(type, n / 3);
+        for (unsigned i = 0; i < n; i++)
+            lod->add(vertex[index[i]]);
+        lod->optimize();
+    }
+    delete [] index;
+
+    return lod;
+}
+
+#endif
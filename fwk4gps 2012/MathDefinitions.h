@@ -1,444 +1,703 @@
-#ifndef _MATH_DEFINITIONS_H_
-#define _MATH_DEFINITIONS_H_
-
-/* Definitions of the Mathematical Functions
- *
- * MathDefinitions.h
- * gam666/dps901/gam670/dps905
- * fwk4gps version 3.0
- * January 14 2012
- * copyright (c) 2012 Chris Szalwinski 
- * distributed under TPL - see ../Licenses.txt
- */
-
-#define _USE_MATH_DEFINES
-#include <math.h>             // for sqrtf, tanf, cosf, sinf
-#include "MathDeclarations.h" // for Vector, Matrix and Colour declarations
-#include "GeneralConstants.h" // for MODEL_Z_AXIS
-
-//-------------------------------- Vector -------------------------------------
-//
-inline Vector& Vector::operator+=(const Vector& a) {
-
-    x += a.x;
-    y += a.y;
-    z += a.z;
-    return *this;
-}
-
-inline Vector Vector::operator+() {
-
-    return *this;
-}
-
-inline Vector Vector::operator-() {
-
-    return Vector(-x, -y, -z);
-}
-
-inline Vector& Vector::operator-=(const Vector& a) {
-
-    x -= a.x;
-    y -= a.y;
-    z -= a.z;
-    return *this;
-}
-
-inline float Vector::length() const {
-
-    return sqrtf(dot(*this, *this));
-}
-
-//------------------------------- Matrix --------------------------------
-//
-
-inline Vector Vector::operator*=(const Matrix& m) {
-
-    *this = Vector(x * m.m11 + y * m.m21 + z * m.m31 + m.m41,
-                   x * m.m12 + y * m.m22 + z * m.m32 + m.m42,
-                   x * m.m13 + y * m.m23 + z * m.m33 + m.m43);
-    return *this;
-}
-
-inline Vector Vector::operator*(const Matrix& m) {
-
-    return Vector(x * m.m11 + y * m.m21 + z * m.m31 + m.m41,
-                  x * m.m12 + y * m.m22 + z * m.m32 + m.m42,
-                  x * m.m13 + y * m.m23 + z * m.m33 + m.m43);
-}
-
-inline Vector Vector::operator*(const Matrix& m) const {
-
-    return Vector(x * m.m11 + y * m.m21 + z * m.m31 + m.m41,
-                  x * m.m12 + y * m.m22 + z * m.m32 + m.m42,
-                  x * m.m13 + y * m.m23 + z * m.m33 + m.m43);
-}
-
-inline Matrix& Matrix::isIdentity() {
-
-    return *this = Matrix(1);
-}
-
-inline Matrix Matrix::transpose() const {
-    return Matrix(m11, m21, m31, m41,
-     m12, m22, m32, m42,
-     m13, m23, m33, m43,
-     m14, m24, m34, m44);
-}
-
-inline Matrix& Matrix::operator+=(const Matrix& a) {
-
-    m11 += a.m11;
-    m12 += a.m12;
-    m13 += a.m13;
-    m14 += a.m14;
-    m21 += a.m21;
-    m22 += a.m22;
-    m23 += a.m23;
-    m24 += a.m24;
-    m31 += a.m31;
-    m32 += a.m32;
-    m33 += a.m33;
-    m34 += a.m34;
-    m41 += a.m41;
-    m42 += a.m42;
-    m43 += a.m43;
-    m44 += a.m44;
-    return *this;
-}
-
-inline Matrix& Matrix::operator-=(const Matrix& a) {
-
-    m11 -= a.m11;
-    m12 -= a.m12;
-    m13 -= a.m13;
-    m14 -= a.m14;
-    m21 -= a.m21;
-    m22 -= a.m22;
-    m23 -= a.m23;
-    m24 -= a.m24;
-    m31 -= a.m31;
-    m32 -= a.m32;
-    m33 -= a.m33;
-    m34 -= a.m34;
-    m41 -= a.m41;
-    m42 -= a.m42;
-    m43 -= a.m43;
-    m44 -= a.m44;
-    return *this;
-}
-
-inline Matrix operator*(const Matrix& a, const Matrix& b) {
-
-    return Matrix(a.m11 * b.m11 + a.m12 * b.m21 + a.m13 * b.m31 + a.m14 * b.m41,
-                  a.m11 * b.m12 + a.m12 * b.m22 + a.m13 * b.m32 + a.m14 * b.m42,
-                  a.m11 * b.m13 + a.m12 * b.m23 + a.m13 * b.m33 + a.m14 * b.m43,
-                  a.m11 * b.m14 + a.m12 * b.m24 + a.m13 * b.m34 + a.m14 * b.m44,
-                  a.m21 * b.m11 + a.m22 * b.m21 + a.m23 * b.m31 + a.m24 * b.m41,
-                  a.m21 * b.m12 + a.m22 * b.m22 + a.m23 * b.m32 + a.m24 * b.m42,
-                  a.m21 * b.m13 + a.m22 * b.m23 + a.m23 * b.m33 + a.m24 * b.m43,
-                  a.m21 * b.m14 + a.m22 * b.m24 + a.m23 * b.m34 + a.m24 * b.m44,
-                  a.m31 * b.m11 + a.m32 * b.m21 + a.m33 * b.m31 + a.m34 * b.m41,
-                  a.m31 * b.m12 + a.m32 * b.m22 + a.m33 * b.m32 + a.m34 * b.m42,
-                  a.m31 * b.m13 + a.m32 * b.m23 + a.m33 * b.m33 + a.m34 * b.m43,
-                  a.m31 * b.m14 + a.m32 * b.m24 + a.m33 * b.m34 + a.m34 * b.m44,
-                  a.m41 * b.m11 + a.m42 * b.m21 + a.m43 * b.m31 + a.m44 * b.m41,
-                  a.m41 * b.m12 + a.m42 * b.m22 + a.m43 * b.m32 + a.m44 * b.m42,
-                  a.m41 * b.m13 + a.m42 * b.m23 + a.m43 * b.m33 + a.m44 * b.m43,
-                  a.m41 * b.m14 + a.m42 * b.m24 + a.m43 * b.m34 + a.m44 * b.m44);
-}
-
-inline Matrix& Matrix::operator*=(const Matrix& a) {
-
-    return *this = Matrix(
-				m11 * a.m11 + m12 * a.m21 + m13 * a.m31 + m14 * a.m41,
-				m11 * a.m12 + m12 * a.m22 + m13 * a.m32 + m14 * a.m42,
-				m11 * a.m13 + m12 * a.m23 + m13 * a.m33 + m14 * a.m43,
-				m11 * a.m14 + m12 * a.m24 + m13 * a.m34 + m14 * a.m44,
-				m21 * a.m11 + m22 * a.m21 + m23 * a.m31 + m24 * a.m41,
-				m21 * a.m12 + m22 * a.m22 + m23 * a.m32 + m24 * a.m42,
-				m21 * a.m13 + m22 * a.m23 + m23 * a.m33 + m24 * a.m43,
-				m21 * a.m14 + m22 * a.m24 + m23 * a.m34 + m24 * a.m44,
-				m31 * a.m11 + m32 * a.m21 + m33 * a.m31 + m34 * a.m41,
-				m31 * a.m12 + m32 * a.m22 + m33 * a.m32 + m34 * a.m42,
-                m31 * a.m13 + m32 * a.m23 + m33 * a.m33 + m34 * a.m43,
-                m31 * a.m14 + m32 * a.m24 + m33 * a.m34 + m34 * a.m44,
-                m41 * a.m11 + m42 * a.m21 + m43 * a.m31 + m44 * a.m41,
-                m41 * a.m12 + m42 * a.m22 + m43 * a.m32 + m44 * a.m42,
-                m41 * a.m13 + m42 * a.m23 + m43 * a.m33 + m44 * a.m43,
-                m41 * a.m14 + m42 * a.m24 + m43 * a.m34 + m44 * a.m44);
-}
-
-inline Vector operator*(const Matrix& a, const Vector& b) {
-
-    return Vector(a.m11 * b.x + a.m12 * b.y + a.m13 * b.z + a.m14,
-                  a.m21 * b.x + a.m22 * b.y + a.m23 * b.z + a.m24,
-                  a.m31 * b.x + a.m32 * b.y + a.m33 * b.z + a.m34);
-}
-
-// scaling transformations
-//
-inline Matrix& scale(Matrix& m, float x, float y, float z) {
-
-    return m = Matrix(x, 0, 0, 0,
-                      0, y, 0, 0,
-                      0, 0, z, 0,
-                      0, 0, 0, 1);
-}
-
-inline Matrix& scale(Matrix& m, const Vector& v) {
-
-    return scale(m, v.x, v.y, v.z);
-}
-
-inline Matrix& Matrix::scale(float sx, float sy, float sz) {
-
-    float x = m41, y = m42, z = m43; 
-	m41 = m42 = m43 = 0;
-    Matrix atOrigin;
-	*this *= ::scale(atOrigin, sx, sy, sz);
-    m41 = x;
-    m42 = y;
-    m43 = z;
-	return *this;
-}
-
-// direction transformations
-//
-// direction transforms direction v into the reference frame describes
-// by the current transformation matrix
-//
-inline Vector Matrix::direction(const Vector& v) const {
-
-    return v * rotation();
-}
-
-// direction returns the orientation of the ? axis in world space
-//
-inline Vector Matrix::direction(char axis) const {
-
-    Vector v;
-
-    switch(axis) {
-        case 'x':
-            v = Vector(1, 0, 0);
-            break;
-        case 'y':
-            v = Vector(0, 1, 0);
-            break;
-        case 'z':
-            v = Vector(0, 0, 1);
-            break;
-    }
-
-    return direction(v);
-}
-
-// position transformations
-//
-// position returns the position stored in the current transformation matrix
-//
-inline Vector Matrix::position() const {
-
-    return Vector(m41, m42, m43);
-}
-
-// position extracts the position vector from transformation m
-//
-inline Vector position(const Matrix& m) {
-
-    return m.position(); 
-}
-
-// rotation transformations
-//
-// rotation extracts the rotation transformation from a homogeneous
-// transformation assuming that there has not been any scaling
-//
-inline Matrix Matrix::rotation() const {
-
-    return Matrix(m11, m12, m13, 0,
-                  m21, m22, m23, 0,
-                  m31, m32, m33, 0,
-                    0,   0,   0, 1);
-}
-
-// rotation extracts the rotation transformation from transformation m 
-//
-inline Matrix rotation(const Matrix& m) {
-
-    return m.rotation();
-}
-
-inline Matrix& Matrix::rotate(const Matrix &rot) {
-
-    float x = m41, y = m42, z = m43; 
-	m41 = m42 = m43 = 0;
-    *this *= rot;
-    m41 = x;
-    m42 = y;
-    m43 = z;
-	return *this;
-}
-
-inline Matrix& Matrix::translate(float x, float y, float z) {
-
-	return *this *= Matrix(1, 0, 0, 0,
-                           0, 1, 0, 0,
-                           0, 0, 1, 0,
-                           x, y, MODEL_Z_AXIS * z, 1);
-}
-
-inline Matrix& Matrix::rotatex(float rad) {
-
-    rad    *= MODEL_Z_AXIS;
-    float c = cosf(rad);
-    float s = sinf(rad);
-    Matrix rot(1, 0, 0, 0,
-               0, c, s, 0,
-               0,-s, c, 0,
-               0, 0, 0, 1);
-    rotate(rot);
-	return *this;
-}
-
-inline Matrix& Matrix::rotatey(float rad) {
-
-	rad    *= MODEL_Z_AXIS;
-    float c = cosf(rad);
-    float s = sinf(rad);
-    Matrix rot(c, 0, s, 0,
-               0, 1, 0, 0,
-              -s, 0, c, 0,
-               0, 0, 0, 1);
-    rotate(rot);
-	return *this;
-}
-
-inline Matrix& Matrix::rotatez(float rad) {
-
-    rad    *= MODEL_Z_AXIS;
-    float c = cosf(rad);
-    float s = sinf(rad);
-    Matrix rot(c, s, 0, 0,
-              -s, c, 0, 0,
-               0, 0, 1, 0,
-               0, 0, 0, 1);
-    rotate(rot);
-	return *this;
-}
-
-inline Matrix& Matrix::orient(const Matrix& rot) {
-
-    Matrix atOrigin;
-	Matrix sts = *this * this->transpose();
-	float sx = sqrtf(sts.m11);
-	float sy = sqrtf(sts.m22);
-	float sz = sqrtf(sts.m33);
-    float x = m41, y = m42, z = m43; 
-    isIdentity();
-    *this = rot;
-	// re-scaling makes the billboard disappear 
-    //if (fabs(sx - 1.f) > 0.05f || fabs(sy - 1.f) > 0.05f || fabs(sz - 1.f) > 0.05f)
-    //    scale(sx, sy, sz);
-    m41 = x;
-    m42 = y;
-    m43 = z;
-	return *this;
-}
-
-inline Matrix& Matrix::rotate(const Vector& axis, float rad) {
-
-    rad    *= MODEL_Z_AXIS;
-    float c = cosf(rad);
-    float s = sinf(rad);
-    float t = 1.f - c;
-    Vector a = normal(axis);
-    Matrix rot(t*a.x*a.x + c,     t*a.x*a.y + a.z*s, t*a.x*a.z - a.y*s, 0,
-               t*a.x*a.y - a.z*s, t*a.y*a.y + c,     t*a.y*a.z + a.x*s, 0,
-               t*a.x*a.z + a.y*s, t*a.y*a.z - a.x*s, t*a.z*a.z + c,     0,
-               0,                 0,                 0,                 1);
-    rotate(rot);
-    return *this;
-}
-
-inline Matrix rotate(const Vector& axis, float rad) {
-
-    rad    *= MODEL_Z_AXIS;
-    float c = cosf(rad);
-    float s = sinf(rad);
-    float t = 1.f - c;
-    Vector a = normal(axis);
-    return Matrix(t*a.x*a.x + c,     t*a.x*a.y + a.z*s, t*a.x*a.z - a.y*s, 0,
-                  t*a.x*a.y - a.z*s, t*a.y*a.y + c,     t*a.y*a.z + a.x*s, 0,
-                  t*a.x*a.z + a.y*s, t*a.y*a.z - a.x*s, t*a.z*a.z + c,     0,
-                  0,                 0,                 0,                 1);
-}
-
-// view returns the view transformation for position p, heading d 
-// and up direction u
-//
-inline Matrix view(const Vector& p, const Vector& d, const Vector& u) {
-
-    Vector z = MODEL_Z_AXIS * normal(d - p);
-    Vector x = normal(cross(u, z));
-    Vector y = cross(z, x);
-    return Matrix(       x.x,        y.x,        z.x,  0,
-                         x.y,        y.y,        z.y,  0,
-                         x.z,        y.z,        z.z,  0,
-                  -dot(x, p), -dot(y, p), -dot(z, p), 1);
-}
-
-// projection returns the projection transformation for field of view fov,
-// client area aspect ratio aspect, near cutoff plane near_cp and far cutoff
-// plane far_cp
-//
-inline Matrix projection(float fov, float aspect, float near_cp, float far_cp) {
-
-	float sy = 1.0f / tanf(fov * 0.5f);
-    float sx = sy / aspect;
-	float sz = far_cp / (far_cp-near_cp);
-    return Matrix(sx,  0,                 0,            0,
-                   0, sy,                 0,            0,
-                   0,  0, sz * MODEL_Z_AXIS, MODEL_Z_AXIS,
-                   0,  0,     -near_cp * sz,            0);
-}
-
-// perspective retruns the projection transformation for an off-center view
-// described by the range [minx, maxx], [miny, maxy], [near_cp, far_cp]
-//
-inline Matrix projection(float minx, float maxx, float miny, float maxy, 
- float near_cp, float far_cp) {
-
-	float sy = 2 * near_cp / (maxy - miny);
-    float sx = 2 * near_cp / (maxx - minx);
-    float zx = (minx + maxx) / (maxx - minx);
-    float zy = (miny + maxy) / (maxy - miny);
-	float sz = far_cp / (far_cp-near_cp);
-    return Matrix(sx,  0,                 0,            0,
-                   0, sy,                 0,            0,
-                  zx, zy, sz * MODEL_Z_AXIS, MODEL_Z_AXIS,
-                   0,  0,     -near_cp * sz,            0);
-}
-
-// projToRhs transforms the lhs projection matrix m into rhs form
-//
-inline Matrix projToRhs(const Matrix& m) {
-
-    return Matrix(m.m11, m.m12,  m.m13,                                    0,
-                  m.m21, m.m22,  m.m23,                                    0,
-                  m.m31, m.m32,  m.m33,                -m.m43 * MODEL_Z_AXIS,
-                  m.m41, m.m42, -m.m34 * MODEL_Z_AXIS,                     0);
-}
-
-// orthographic returns the orthographic transformation
-//
-inline Matrix orthographic(int w, int h) {
-
-    return Matrix(2.f/w,     0,  0, 0,
-                      0, 2.f/h,  0, 0,
-                      0,     0, -1, 0,
-                     -1,    -1,  0, 1);
-}
-
-#endif
+#ifndef _MATH_DEFINITIONS_H_
+#define _MATH_DEFINITIONS_H_
+
+/* Definitions of the Mathematical Functions
+ *
+ * MathDefinitions.h
+ * gam666/dps901/gam670/dps905
+ * fwk4gps version 3.0
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#define _USE_MATH_DEFINES
+#include <math.h>             // for sqrtf, tanf, cosf, sinf
+#include "MathDeclarations.h" // for Vector, Matrix and Colour declarations
+#include "GeneralConstants.h" // for MODEL_Z_AXIS
+
+//-------------------------------- Vector -------------------------------------
+//
+inline Vector& Vector::operator+=(const Vector& a) {
+
+    x += a.x;
+    y += a.y;
+    z += a.z;
+    return *this;
+}
+
+inline Vector Vector::operator+() {
+
+    return *this;
+}
+
+inline Vector Vector::operator-() {
+
+    return Vector(-x, -y, -z);
+}
+
+inline Vector& Vector::operator-=(const Vector& a) {
+
+    x -= a.x;
+    y -= a.y;
+    z -= a.z;
+    return *this;
+}
+
+inline float Vector::length() const {
+
+    return sqrtf(dot(*this, *this));
+}
+
+//------------------------------- Matrix --------------------------------
+//
+
+inline Vector Vector::operator*=(const Matrix& m) {
+
+    *this = Vector(x * m.m11 + y * m.m21 + z * m.m31 + m.m41,
+                   x * m.m12 + y * m.m22 + z * m.m32 + m.m42,
+                   x * m.m13 + y * m.m23 + z * m.m33 + m.m43);
+    return *this;
+}
+
+inline Vector Vector::operator*(const Matrix& m) {
+
+    return Vector(x * m.m11 + y * m.m21 + z * m.m31 + m.m41,
+                  x * m.m12 + y * m.m22 + z * m.m32 + m.m42,
+                  x * m.m13 + y * m.m23 + z * m.m33 + m.m43);
+}
+
+inline Vector Vector::operator*(const Matrix& m) const {
+
+    return Vector(x * m.m11 + y * m.m21 + z * m.m31 + m.m41,
+                  x * m.m12 + y * m.m22 + z * m.m32 + m.m42,
+                  x * m.m13 + y * m.m23 + z * m.m33 + m.m43);
+}
+
+inline Matrix& Matrix::isIdentity() {
+
+    return *this = Matrix(1);
+}
+
+inline Matrix Matrix::transpose() const {
+    return Matrix(m11, m21, m31, m41,
+     m12, m22, m32, m42,
+     m13, m23, m33, m43,
+     m14, m24, m34, m44);
+}
+
+inline Matrix& Matrix::operator+=(const Matrix& a) {
+
+    m11 += a.m11;
+    m12 += a.m12;
+    m13 += a.m13;
+    m14 += a.m14;
+    m21 += a.m21;
+    m22 += a.m22;
+    m23 += a.m23;
+    m24 += a.m24;
+    m31 += a.m31;
+    m32 += a.m32;
+    m33 += a.m33;
+    m34 += a.m34;
+    m41 += a.m41;
+    m42 += a.m42;
+    m43 += a.m43;
+    m44 += a.m44;
+    return *this;
+}
+
+inline Matrix& Matrix::operator-=(const Matrix& a) {
+
+    m11 -= a.m11;
+    m12 -= a.m12;
+    m13 -= a.m13;
+    m14 -= a.m14;
+    m21 -= a.m21;
+    m22 -= a.m22;
+    m23 -= a.m23;
+    m24 -= a.m24;
+    m31 -= a.m31;
+    m32 -= a.m32;
+    m33 -= a.m33;
+    m34 -= a.m34;
+    m41 -= a.m41;
+    m42 -= a.m42;
+    m43 -= a.m43;
+    m44 -= a.m44;
+    return *this;
+}
+
+inline Matrix operator*(const Matrix& a, const Matrix& b) {
+
+    return Matrix(a.m11 * b.m11 + a.m12 * b.m21 + a.m13 * b.m31 + a.m14 * b.m41,
+                  a.m11 * b.m12 + a.m12 * b.m22 + a.m13 * b.m32 + a.m14 * b.m42,
+                  a.m11 * b.m13 + a.m12 * b.m23 + a.m13 * b.m33 + a.m14 * b.m43,
+                  a.m11 * b.m14 + a.m12 * b.m24 + a.m13 * b.m34 + a.m14 * b.m44,
+                  a.m21 * b.m11 + a.m22 * b.m21 + a.m23 * b.m31 + a.m24 * b.m41,
+                  a.m21 * b.m12 + a.m22 * b.m22 + a.m23 * b.m32 + a.m24 * b.m42,
+                  a.m21 * b.m13 + a.m22 * b.m23 + a.m23 * b.m33 + a.m24 * b.m43,
+                  a.m21 * b.m14 + a.m22 * b.m24 + a.m23 * b.m34 + a.m24 * b.m44,
+                  a.m31 * b.m11 + a.m32 * b.m21 + a.m33 * b.m31 + a.m34 * b.m41,
+                  a.m31 * b.m12 + a.m32 * b.m22 + a.m33 * b.m32 + a.m34 * b.m42,
+                  a.m31 * b.m13 + a.m32 * b.m23 + a.m33 * b.m33 + a.m34 * b.m43,
+                  a.m31 * b.m14 + a.m32 * b.m24 + a.m33 * b.m34 + a.m34 * b.m44,
+                  a.m41 * b.m11 + a.m42 * b.m21 + a.m43 * b.m31 + a.m44 * b.m41,
+                  a.m41 * b.m12 + a.m42 * b.m22 + a.m43 * b.m32 + a.m44 * b.m42,
+                  a.m41 * b.m13 + a.m42 * b.m23 + a.m43 * b.m33 + a.m44 * b.m43,
+                  a.m41 * b.m14 + a.m42 * b.m24 + a.m43 * b.m34 + a.m44 * b.m44);
+}
+
+inline Matrix& Matrix::operator*=(const Matrix& a) {
+
+    return *this = Matrix(
+				m11 * a.m11 + m12 * a.m21 + m13 * a.m31 + m14 * a.m41,
+				m11 * a.m12 + m12 * a.m22 + m13 * a.m32 + m14 * a.m42,
+				m11 * a.m13 + m12 * a.m23 + m13 * a.m33 + m14 * a.m43,
+				m11 * a.m14 + m12 * a.m24 + m13 * a.m34 + m14 * a.m44,
+				m21 * a.m11 + m22 * a.m21 + m23 * a.m31 + m24 * a.m41,
+				m21 * a.m12 + m22 * a.m22 + m23 * a.m32 + m24 * a.m42,
+				m21 * a.m13 + m22 * a.m23 + m23 * a.m33 + m24 * a.m43,
+				m21 * a.m14 + m22 * a.m24 + m23 * a.m34 + m24 * a.m44,
+				m31 * a.m11 + m32 * a.m21 + m33 * a.m31 + m34 * a.m41,
+				m31 * a.m12 + m32 * a.m22 + m33 * a.m32 + m34 * a.m42,
+                m31 * a.m13 + m32 * a.m23 + m33 * a.m33 + m34 * a.m43,
+                m31 * a.m14 + m32 * a.m24 + m33 * a.m34 + m34 * a.m44,
+                m41 * a.m11 + m42 * a.m21 + m43 * a.m31 + m44 * a.m41,
+                m41 * a.m12 + m42 * a.m22 + m43 * a.m32 + m44 * a.m42,
+                m41 * a.m13 + m42 * a.m23 + m43 * a.m33 + m44 * a.m43,
+                m41 * a.m14 + m42 * a.m24 + m43 * a.m34 + m44 * a.m44);
+}
+
+inline Vector operator*(const Matrix& a, const Vector& b) {
+
+    return Vector(a.m11 * b.x + a.m12 * b.y + a.m13 * b.z + a.m14,
+                  a.m21 * b.x + a.m22 * b.y + a.m23 * b.z + a.m24,
+                  a.m31 * b.x + a.m32 * b.y + a.m33 * b.z + a.m34);
+}
+
+// scaling transformations
+//
+inline Matrix& scale(Matrix& m, float x, float y, float z) {
+
+    return m = Matrix(x, 0, 0, 0,
+                      0, y, 0, 0,
+                      0, 0, z, 0,
+                      0, 0, 0, 1);
+}
+
+inline Matrix& scale(Matrix& m, const Vector& v) {
+
+    return scale(m, v.x, v.y, v.z);
+}
+
+inline Matrix& Matrix::scale(float sx, float sy, float sz) {
+
+    float x = m41, y = m42, z = m43; 
+	m41 = m42 = m43 = 0;
+    Matrix atOrigin;
+	*this *= ::scale(atOrigin, sx, sy, sz);
+    m41 = x;
+    m42 = y;
+    m43 = z;
+	return *this;
+}
+
+// direction transformations
+//
+// direction transforms direction v into the reference frame describes
+// by the current transformation matrix
+//
+inline Vector Matrix::direction(const Vector& v) const {
+
+    return v * rotation();
+}
+
+// direction returns the orientation of the ? axis in world space
+//
+inline Vector Matrix::direction(char axis) const {
+
+    Vector v;
+
+    switch(axis) {
+        case 'x':
+            v = Vector(1, 0, 0);
+            break;
+        case 'y':
+            v = Vector(0, 1, 0);
+            break;
+        case 'z':
+            v = Vector(0, 0, 1);
+            break;
+    }
+
+    return direction(v);
+}
+
+// position transformations
+//
+// position returns the position stored in the current transformation matrix
+//
+inline Vector Matrix::position() const {
+
+    return Vector(m41, m42, m43);
+}
+
+// position extracts the position vector from transformation m
+//
+inline Vector position(const Matrix& m) {
+
+    return m.position(); 
+}
+
+// rotation transformations
+//
+// rotation extracts the rotation transformation from a homogeneous
+// transformation assuming that there has not been any scaling
+//
+inline Matrix Matrix::rotation() const {
+
+    return Matrix(m11, m12, m13, 0,
+                  m21, m22, m23, 0,
+                  m31, m32, m33, 0,
+                    0,   0,   0, 1);
+}
+
+// rotation extracts the rotation transformation from transformation m 
+//
+inline Matrix rotation(const Matrix& m) {
+
+    return m.rotation();
+}
+
+// normalTransform returns the transformation that carries normals under
+// transformation m - the cofactors of the upper 3x3 block, which are the
+// inverse transpose up to a scale factor - the sign keeps normals facing
+// outwards under reflections
+//
+inline Matrix normalTransform(const Matrix& m) {
+
+    float c11 = m.m22 * m.m33 - m.m23 * m.m32;
+    float c12 = m.m23 * m.m31 - m.m21 * m.m33;
+    float c13 = m.m21 * m.m32 - m.m22 * m.m31;
+    float s   = m.m11 * c11 + m.m12 * c12 + m.m13 * c13 < 0 ? -1.f : 1.f;
+    return Matrix(s * c11, s * c12, s * c13, 0,
+     s * (m.m13 * m.m32 - m.m12 * m.m33), s * (m.m11 * m.m33 - m.m13 * m.m31),
+     s * (m.m12 * m.m31 - m.m11 * m.m32), 0,
+     s * (m.m12 * m.m23 - m.m13 * m.m22), s * (m.m13 * m.m21 - m.m11 * m.m23),
+     s * (m.m11 * m.m22 - m.m12 * m.m21), 0,
+     0, 0, 0, 1);
+}
+
+// inverse returns the inverse of affine transformation m - the inverse of
+// its 3x3 block is the transposed cofactors over the determinant and the
+// translation is carried back through that inverse
+//
+inline Matrix inverse(const Matrix& m) {
+
+    float c11 = m.m22 * m.m33 - m.m23 * m.m32;
+    float c12 = m.m23 * m.m31 - m.m21 * m.m33;
+    float c13 = m.m21 * m.m32 - m.m22 * m.m31;
+    float det = m.m11 * c11 + m.m12 * c12 + m.m13 * c13;
+    float r   = det ? 1 / det : 0;
+    Matrix i(r * c11, r * (m.m13 * m.m32 - m.m12 * m.m33),
+     r * (m.m12 * m.m23 - m.m13 * m.m22), 0,
+     r * c12, r * (m.m11 * m.m33 - m.m13 * m.m31),
+     r * (m.m13 * m.m21 - m.m11 * m.m23), 0,
+     r * c13, r * (m.m12 * m.m31 - m.m11 * m.m32),
+     r * (m.m11 * m.m22 - m.m12 * m.m21), 0,
+     0, 0, 0, 1);
+    i.m41 = -(m.m41 * i.m11 + m.m42 * i.m21 + m.m43 * i.m31);
+    i.m42 = -(m.m41 * i.m12 + m.m42 * i.m22 + m.m43 * i.m32);
+    i.m43 = -(m.m41 * i.m13 + m.m42 * i.m23 + m.m43 * i.m33);
+    return i;
+}
+
+inline Matrix& Matrix::rotate(const Matrix &rot) {
+
+    float x = m41, y = m42, z = m43; 
+	m41 = m42 = m43 = 0;
+    *this *= rot;
+    m41 = x;
+    m42 = y;
+    m43 = z;
+	return *this;
+}
+
+inline Matrix& Matrix::translate(float x, float y, float z) {
+
+	return *this *= Matrix(1, 0, 0, 0,
+                           0, 1, 0, 0,
+                           0, 0, 1, 0,
+                           x, y, MODEL_Z_AXIS * z, 1);
+}
+
+inline Matrix& Matrix::rotatex(float rad) {
+
+    rad    *= MODEL_Z_AXIS;
+    float c = cosf(rad);
+    float s = sinf(rad);
+    Matrix rot(1, 0, 0, 0,
+               0, c, s, 0,
+               0,-s, c, 0,
+               0, 0, 0, 1);
+    rotate(rot);
+	return *this;
+}
+
+inline Matrix& Matrix::rotatey(float rad) {
+
+	rad    *= MODEL_Z_AXIS;
+    float c = cosf(rad);
+    float s = sinf(rad);
+    Matrix rot(c, 0, s, 0,
+               0, 1, 0, 0,
+              -s, 0, c, 0,
+               0, 0, 0, 1);
+    rotate(rot);
+	return *this;
+}
+
+inline Matrix& Matrix::rotatez(float rad) {
+
+    rad    *= MODEL_Z_AXIS;
+    float c = cosf(rad);
+    float s = sinf(rad);
+    Matrix rot(c, s, 0, 0,
+              -s, c, 0, 0,
+               0, 0, 1, 0,
+               0, 0, 0, 1);
+    rotate(rot);
+	return *this;
+}
+
+inline Matrix& Matrix::orient(const Matrix& rot) {
+
+    Matrix atOrigin;
+	Matrix sts = *this * this->transpose();
+	float sx = sqrtf(sts.m11);
+	float sy = sqrtf(sts.m22);
+	float sz = sqrtf(sts.m33);
+    float x = m41, y = m42, z = m43; 
+    isIdentity();
+    *this = rot;
+	// re-scaling makes the billboard disappear 
+    //if (fabs(sx - 1.f) > 0.05f || fabs(sy - 1.f) > 0.05f || fabs(sz - 1.f) > 0.05f)
+    //    scale(sx, sy, sz);
+    m41 = x;
+    m42 = y;
+    m43 = z;
+	return *this;
+}
+
+inline Matrix& Matrix::rotate(const Vector& axis, float rad) {
+
+    rad    *= MODEL_Z_AXIS;
+    float c = cosf(rad);
+    float s = sinf(rad);
+    float t = 1.f - c;
+    Vector a = normal(axis);
+    Matrix rot(t*a.x*a.x + c,     t*a.x*a.y + a.z*s, t*a.x*a.z - a.y*s, 0,
+               t*a.x*a.y - a.z*s, t*a.y*a.y + c,     t*a.y*a.z + a.x*s, 0,
+               t*a.x*a.z + a.y*s, t*a.y*a.z - a.x*s, t*a.z*a.z + c,     0,
+               0,                 0,                 0,                 1);
+    rotate(rot);
+    return *this;
+}
+
+inline Matrix rotate(const Vector& axis, float rad) {
+
+    rad    *= MODEL_Z_AXIS;
+    float c = cosf(rad);
+    float s = sinf(rad);
+    float t = 1.f - c;
+    Vector a = normal(axis);
+    return Matrix(t*a.x*a.x + c,     t*a.x*a.y + a.z*s, t*a.x*a.z - a.y*s, 0,
+                  t*a.x*a.y - a.z*s, t*a.y*a.y + c,     t*a.y*a.z + a.x*s, 0,
+                  t*a.x*a.z + a.y*s, t*a.y*a.z - a.x*s, t*a.z*a.z + c,     0,
+                  0,                 0,                 0,                 1);
+}
+
+//------------------------------- Quaternion ----------------------------------
+//
+inline Quaternion operator*(const Quaternion& a, const Quaternion& b) {
+
+    return Quaternion(b.w * a.x + b.x * a.w + b.y * a.z - b.z * a.y,
+                      b.w * a.y + b.y * a.w + b.z * a.x - b.x * a.z,
+                      b.w * a.z + b.z * a.w + b.x * a.y - b.y * a.x,
+                      b.w * a.w - b.x * a.x - b.y * a.y - b.z * a.z);
+}
+
+inline float dot(const Quaternion& a, const Quaternion& b) {
+
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+
+inline Quaternion normal(const Quaternion& q) {
+
+    float n = sqrtf(dot(q, q));
+    float s = n ? 1 / n : 0;
+    return n ? Quaternion(q.x * s, q.y * s, q.z * s, q.w * s) : Quaternion();
+}
+
+// conjugate returns the conjugate of q - the inverse rotation of a unit
+// quaternion
+//
+inline Quaternion conjugate(const Quaternion& q) {
+
+    return Quaternion(-q.x, -q.y, -q.z, q.w);
+}
+
+// operator* returns v rotated by unit quaternion q - the same as v times
+// rotate(q) without building the matrix
+//
+inline Vector operator*(const Vector& v, const Quaternion& q) {
+
+    Vector t = 2 * cross(Vector(q.x, q.y, q.z), v);
+    return v + q.w * t + cross(Vector(q.x, q.y, q.z), t);
+}
+
+// quaternion returns the rotation through rad radians about axis 
+//
+inline Quaternion quaternion(const Vector& axis, float rad) {
+
+    rad    *= MODEL_Z_AXIS;
+    Vector a = normal(axis);
+    float  s = sinf(0.5f * rad);
+    return Quaternion(s * a.x, s * a.y, s * a.z, cosf(0.5f * rad));
+}
+
+// angle returns the angle in radians of the rotation held by unit
+// quaternion q and stores its axis in axis - the inverse of
+// quaternion(axis, rad)
+//
+inline float angle(const Quaternion& q, Vector& axis) {
+
+    float s = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z);
+    axis    = s > 1e-9f ? Vector(q.x / s, q.y / s, q.z / s) : Vector(1, 0, 0);
+    return 2 * atan2f(s, q.w) * MODEL_Z_AXIS;
+}
+
+// quaternion returns the rotation through rx radians about the x axis,
+// then ry about the y axis and then rz about the z axis - the same as
+// Matrix::rotatex, rotatey and rotatez in that order
+//
+inline Quaternion quaternion(float rx, float ry, float rz) {
+
+    return quaternion(Vector(1, 0, 0), rx) * quaternion(Vector(0, 1, 0), -ry)
+     * quaternion(Vector(0, 0, 1), rz);
+}
+
+// euler returns the angles about the x, y and z axes that
+// quaternion(rx, ry, rz) turns into unit quaternion q - at a y angle of 
+// +-pi/2 the z angle is 0
+//
+inline Vector euler(const Quaternion& q) {
+
+    float m13 = 2 * (q.x * q.z - q.w * q.y);
+    float rx, ry, rz;
+    if (m13 > 0.99999f || m13 < -0.99999f) {
+        ry = m13 > 0 ? 1.5707963f : -1.5707963f;
+        rx = atan2f(2 * (q.w * q.x - q.y * q.z),
+         1 - 2 * (q.x * q.x + q.z * q.z));
+        rz = 0;
+    }
+    else {
+        ry = asinf(m13);
+        rx = atan2f(2 * (q.y * q.z + q.w * q.x),
+         1 - 2 * (q.x * q.x + q.y * q.y));
+        rz = atan2f(2 * (q.x * q.y + q.w * q.z),
+         1 - 2 * (q.y * q.y + q.z * q.z));
+    }
+    return Vector(rx * MODEL_Z_AXIS, ry * MODEL_Z_AXIS, rz * MODEL_Z_AXIS);
+}
+
+// quaternion extracts the rotation from the rotation block of m, assuming
+// that there has not been any scaling
+//
+inline Quaternion quaternion(const Matrix& m) {
+
+    Quaternion q;
+    float t = m.m11 + m.m22 + m.m33;
+    if (t > 0) {
+        float s = 0.5f / sqrtf(t + 1);
+        q = Quaternion((m.m23 - m.m32) * s, (m.m31 - m.m13) * s, 
+         (m.m12 - m.m21) * s, 0.25f / s);
+    }
+    else if (m.m11 > m.m22 && m.m11 > m.m33) {
+        float s = 2 * sqrtf(1 + m.m11 - m.m22 - m.m33);
+        q = Quaternion(0.25f * s, (m.m12 + m.m21) / s, (m.m31 + m.m13) / s,
+         (m.m23 - m.m32) / s);
+    }
+    else if (m.m22 > m.m33) {
+        float s = 2 * sqrtf(1 + m.m22 - m.m11 - m.m33);
+        q = Quaternion((m.m12 + m.m21) / s, 0.25f * s, (m.m23 + m.m32) / s,
+         (m.m31 - m.m13) / s);
+    }
+    else {
+        float s = 2 * sqrtf(1 + m.m33 - m.m11 - m.m22);
+        q = Quaternion((m.m31 + m.m13) / s, (m.m23 + m.m32) / s, 0.25f * s,
+         (m.m12 - m.m21) / s);
+    }
+    return normal(q);
+}
+
+// rotate returns the rotation transformation that unit quaternion q holds
+//
+inline Matrix rotate(const Quaternion& q) {
+
+    float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+    return Matrix(1 - 2 * (yy + zz),     2 * (xy + wz),     2 * (xz - wy), 0,
+                      2 * (xy - wz), 1 - 2 * (xx + zz),     2 * (yz + wx), 0,
+                      2 * (xz + wy),     2 * (yz - wx), 1 - 2 * (xx + yy), 0,
+                                  0,                 0,                 0, 1);
+}
+
+// nlerp blends unit quaternions a and b by fraction t along the shorter arc
+// and normalizes the result - faster than slerp but not at constant speed
+//
+inline Quaternion nlerp(const Quaternion& a, const Quaternion& b, float t) {
+
+    float u = dot(a, b) < 0 ? -t : t, s = 1 - t;
+    return normal(Quaternion(s * a.x + u * b.x, s * a.y + u * b.y,
+     s * a.z + u * b.z, s * a.w + u * b.w));
+}
+
+// slerp interpolates unit quaternions a and b by fraction t along the 
+// shorter arc at constant angular speed
+//
+inline Quaternion slerp(const Quaternion& a, const Quaternion& b, float t) {
+
+    float c = dot(a, b), sign = 1;
+    if (c < 0) {
+        c    = -c;
+        sign = -1;
+    }
+    // nearly parallel rotations blend linearly
+    if (c > 0.9995f)
+        return nlerp(a, b, t);
+    float angle = acosf(c);
+    float r     = 1 / sinf(angle);
+    float s     = sinf((1 - t) * angle) * r;
+    float u     = sign * sinf(t * angle) * r;
+    return Quaternion(s * a.x + u * b.x, s * a.y + u * b.y, s * a.z + u * b.z,
+     s * a.w + u * b.w);
+}
+
+// log returns the logarithm of unit quaternion q - the pure quaternion
+// of half its angle along its axis
+//
+inline Quaternion log(const Quaternion& q) {
+
+    float w = q.w > 1 ? 1 : q.w < -1 ? -1 : q.w;
+    float a = acosf(w), s = sinf(a);
+    float k = s > 1e-6f ? a / s : 1;
+    return Quaternion(k * q.x, k * q.y, k * q.z, 0);
+}
+
+// exp returns the exponential of pure quaternion q - the inverse of log
+//
+inline Quaternion exp(const Quaternion& q) {
+
+    float a = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z);
+    float k = a > 1e-6f ? sinf(a) / a : 1;
+    return Quaternion(k * q.x, k * q.y, k * q.z, cosf(a));
+}
+
+// squadControl returns the control quaternion of key q between keys p and
+// n for squad - the keys are on one hemisphere
+//
+inline Quaternion squadControl(const Quaternion& p, const Quaternion& q,
+ const Quaternion& n) {
+
+    Quaternion c = conjugate(q);
+    Quaternion a = log(c * n), b = log(c * p);
+    return q * exp(Quaternion(-0.25f * (a.x + b.x), -0.25f * (a.y + b.y),
+     -0.25f * (a.z + b.z), 0));
+}
+
+// squad interpolates unit quaternions a and b by fraction t along a curve
+// that is smooth through a sequence of keys - sa and sb are the control
+// quaternions of a and b from squadControl
+//
+// the controls may lie on opposite hemispheres, so their blend runs through
+// their midpoint rather than along the shorter arc
+//
+inline Quaternion squad(const Quaternion& a, const Quaternion& b,
+ const Quaternion& sa, const Quaternion& sb, float t) {
+
+    Quaternion m = normal(Quaternion(sa.x + sb.x, sa.y + sb.y, sa.z + sb.z,
+     sa.w + sb.w));
+    Quaternion s = t < 0.5f ? slerp(sa, m, 2 * t) : slerp(m, sb, 2 * t - 1);
+    return slerp(slerp(a, b, t), s, 2 * t * (1 - t));
+}
+
+// view returns the view transformation for position p, heading d 
+// and up direction u
+//
+inline Matrix view(const Vector& p, const Vector& d, const Vector& u) {
+
+    Vector z = MODEL_Z_AXIS * normal(d - p);
+    Vector x = normal(cross(u, z));
+    Vector y = cross(z, x);
+    return Matrix(       x.x,        y.x,        z.x,  0,
+                         x.y,        y.y,        z.y,  0,
+                         x.z,        y.z,        z.z,  0,
+                  -dot(x, p), -dot(y, p), -dot(z, p), 1);
+}
+
+// projection returns the projection transformation for field of view fov,
+// client area aspect ratio aspect, near cutoff plane near_cp and far cutoff
+// plane far_cp
+//
+inline Matrix projection(float fov, float aspect, float near_cp, float far_cp) {
+
+	float sy = 1.0f / tanf(fov * 0.5f);
+    float sx = sy / aspect;
+	float sz = far_cp / (far_cp-near_cp);
+    return Matrix(sx,  0,                 0,            0,
+                   0, sy,                 0,            0,
+                   0,  0, sz * MODEL_Z_AXIS, MODEL_Z_AXIS,
+                   0,  0,     -near_cp * sz,            0);
+}
+
+// perspective retruns the projection transformation for an off-center view
+// described by the range [minx, maxx], [miny, maxy], [near_cp, far_cp]
+//
+inline Matrix projection(float minx, float maxx, float miny, float maxy, 
+ float near_cp, float far_cp) {
+
+	float sy = 2 * near_cp / (maxy - miny);
+    float sx = 2 * near_cp / (maxx - minx);
+    float zx = (minx + maxx) / (maxx - minx);
+    float zy = (miny + maxy) / (maxy - miny);
+	float sz = far_cp / (far_cp-near_cp);
+    return Matrix(sx,  0,                 0,            0,
+                   0, sy,                 0,            0,
+                  zx, zy, sz * MODEL_Z_AXIS, MODEL_Z_AXIS,
+                   0,  0,     -near_cp * sz,            0);
+}
+
+// projToRhs transforms the lhs projection matrix m into rhs form
+//
+inline Matrix projToRhs(const Matrix& m) {
+
+    return Matrix(m.m11, m.m12,  m.m13,                                    0,
+                  m.m21, m.m22,  m.m23,                                    0,
+                  m.m31, m.m32,  m.m33,                -m.m43 * MODEL_Z_AXIS,
+                  m.m41, m.m42, -m.m34 * MODEL_Z_AXIS,                     0);
+}
+
+// orthographic returns the orthographic transformation
+//
+inline Matrix orthographic(int w, int h) {
+
+    return Matrix(2.f/w,     0,  0, 0,
+                      0, 2.f/h,  0, 0,
+                      0,     0, -1, 0,
+                     -1,    -1,  0, 1);
+}
+
+#endif
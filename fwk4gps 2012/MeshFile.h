@@ -0,0 +1,62 @@
+#ifndef _MESH_FILE_H_
+#define _MESH_FILE_H_
+
+/* MeshFile Format - Modelling Layer
+ *
+ * MeshFile.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+//-------------------------------- MeshFile -----------------------------------
+//
+// A binary mesh file holds a MeshHeader followed by the vertex blob and the
+// index blob, each starting on a MESH_ALIGN boundary - the vertex blob has
+// the memory layout of the framework's vertex class so that the loader can
+// copy it without parsing - positions are stored relative to the centroid
+// as the text loaders store them
+//
+// meshconv -b writes files through this same header, so the converter and
+// the loader cannot disagree about the layout
+//
+#define MESH_MAGIC   0x4D4B5746u // "FWKM"
+#define MESH_VERSION 1
+#define MESH_ALIGN   16
+
+// vertex attributes - each is a set of floats in the order listed
+#define MESH_POSITION 1 // x y z
+#define MESH_NORMAL   2 // nx ny nz
+#define MESH_TEXCOORD 4 // tu tv
+
+// the attribute sets that the framework loads
+#define MESH_VERTEX    (MESH_POSITION | MESH_NORMAL | MESH_TEXCOORD)
+#define MESH_POSITIONS MESH_POSITION
+
+struct MeshHeader {
+    unsigned magic;         // MESH_MAGIC
+    unsigned version;       // MESH_VERSION
+    unsigned headerSize;    // sizeof(MeshHeader)
+    unsigned fileSize;      // size of the file in bytes
+    unsigned attributes;    // MESH_POSITION | MESH_NORMAL | MESH_TEXCOORD
+    unsigned vertexSize;    // bytes per vertex
+    unsigned nVertices;     // number of vertices in the vertex blob
+    unsigned vertexOffset;  // offset of the vertex blob from the file start
+    unsigned indexSize;     // bytes per index - 2 or 4
+    unsigned nIndices;      // number of indices in the index blob
+    unsigned indexOffset;   // offset of the index blob from the file start
+    float    centroid[3];   // centroid removed from the positions
+    float    minimum[3];    // minimum corner of the bounding box
+    float    maximum[3];    // maximum corner of the bounding box
+};
+
+// meshAlign rounds offset up to the next MESH_ALIGN boundary
+//
+inline unsigned meshAlign(unsigned offset) {
+
+    return (offset + MESH_ALIGN - 1) & ~(MESH_ALIGN - 1u);
+}
+
+#endif
@@ -0,0 +1,756 @@
+/* MeshOptimizer Implementation - Modelling Layer
+ *
+ * MeshOptimizer.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <cmath>           // for powf, sqrtf
+#include <cstring>         // for memcpy
+#include <vector>
+#include <algorithm>       // for stable_sort, sort
+#include "MeshOptimizer.h" // for the optimizer declarations
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE__)
+#define BOUNDS_SSE
+#include <xmmintrin.h>     // for the SSE intrinsics
+#endif
+
+// scoring constants for the vertex cache reordering
+#define CACHE_DECAY_POWER   1.5f
+#define LAST_TRIANGLE_SCORE 0.75f
+#define VALENCE_BOOST_SCALE 2.0f
+#define VALENCE_BOOST_POWER 0.5f
+#define MAX_VALENCE_SCORED  32
+
+//-------------------------------- ACMR ---------------------------------------
+//
+// acmr simulates a FIFO post-transform cache of cacheSize entries and
+// returns the average number of cache misses per triangle - 3.0 is the
+// worst case, 0.5 is near the best possible for a regular grid
+//
+float acmr(const unsigned* index, unsigned nIndices, unsigned cacheSize) {
+
+    unsigned nTriangles = nIndices / 3;
+    if (!nTriangles || !cacheSize) return 0;
+
+    std::vector<unsigned> fifo(cacheSize);
+    unsigned head = 0, size = 0, misses = 0;
+
+    for (unsigned i = 0; i < nTriangles * 3; i++) {
+        bool hit = false;
+        for (unsigned k = 0; k < size && !hit; k++)
+            hit = fifo[k] == index[i];
+        if (!hit) {
+            misses++;
+            fifo[head] = index[i];
+            head = (head + 1) % cacheSize;
+            if (size < cacheSize) size++;
+        }
+    }
+
+    return (float)misses / nTriangles;
+}
+
+//-------------------------------- Vertex Cache -------------------------------
+//
+// vertexScore returns the score of a vertex at position cachePos in the
+// modelled LRU cache - -1 if not cached - with live unemitted triangles -
+// Forsyth's linear-speed vertex cache optimization
+//
+static float vertexScore(int cachePos, unsigned live) {
+
+    if (!live) return -1.0f;
+
+    float score = 0;
+    if (cachePos >= 0) {
+        if (cachePos < 3)
+            // the most recent triangle's vertices are scored lower so that
+            // the next triangle does not simply reuse them
+            score = LAST_TRIANGLE_SCORE;
+        else
+            score = powf(1.0f - (float)(cachePos - 3) /
+             (OPTIMIZE_CACHE_SIZE - 3), CACHE_DECAY_POWER);
+    }
+    // favour vertices with few triangles left so that they leave the mesh
+    score += VALENCE_BOOST_SCALE * powf((float)live, -VALENCE_BOOST_POWER);
+
+    return score;
+}
+
+// optimizeVertexCache reorders the nIndices / 3 triangles of an indexed
+// list so that consecutive triangles share vertices that are still in the
+// post-transform cache - greedily emits the triangle with the highest
+// score among those touched by the cached vertices
+//
+void optimizeVertexCache(unsigned* index, unsigned nIndices,
+ unsigned nVertices) {
+
+    unsigned nTriangles = nIndices / 3;
+    if (nTriangles < 2 || !nVertices) return;
+
+    // triangles adjacent to each vertex - compressed row storage
+    std::vector<unsigned> live(nVertices, 0), offset(nVertices + 1, 0);
+    for (unsigned i = 0; i < nTriangles * 3; i++)
+        live[index[i]]++;
+    for (unsigned v = 0; v < nVertices; v++)
+        offset[v + 1] = offset[v] + live[v];
+    std::vector<unsigned> adjacent(offset[nVertices]), fill(offset.begin(),
+     offset.end() - 1);
+    for (unsigned t = 0; t < nTriangles; t++)
+        for (unsigned k = 0; k < 3; k++)
+            adjacent[fill[index[3 * t + k]]++] = t;
+
+    // precomputed scores
+    float cacheScore[OPTIMIZE_CACHE_SIZE], valenceScore[MAX_VALENCE_SCORED];
+    for (int p = 0; p < OPTIMIZE_CACHE_SIZE; p++)
+        cacheScore[p] = vertexScore(p, 1) - vertexScore(-1, 1);
+    for (unsigned l = 0; l < MAX_VALENCE_SCORED; l++)
+        valenceScore[l] = vertexScore(-1, l);
+
+    std::vector<float> score(nVertices), triScore(nTriangles);
+    std::vector<bool>  emitted(nTriangles, false);
+    for (unsigned v = 0; v < nVertices; v++)
+        score[v] = live[v] < MAX_VALENCE_SCORED ? valenceScore[live[v]] :
+         vertexScore(-1, live[v]);
+    for (unsigned t = 0; t < nTriangles; t++)
+        triScore[t] = score[index[3 * t]] + score[index[3 * t + 1]] +
+         score[index[3 * t + 2]];
+
+    std::vector<unsigned> output(nTriangles * 3);
+    unsigned cache[OPTIMIZE_CACHE_SIZE + 3], newCache[OPTIMIZE_CACHE_SIZE + 3];
+    unsigned cacheSize = 0, cursor = 0;
+    int best = 0;
+    for (unsigned t = 1; t < nTriangles; t++)
+        if (triScore[t] > triScore[best]) best = t;
+
+    for (unsigned n = 0; n < nTriangles; n++) {
+        // no cached vertex has a live triangle - take the next unemitted
+        if (best < 0) {
+            while (emitted[cursor]) cursor++;
+            best = cursor;
+        }
+
+        // emit the triangle and remove it from its vertices' adjacency
+        const unsigned* tri = &index[3 * best];
+        emitted[best] = true;
+        for (unsigned k = 0; k < 3; k++) {
+            unsigned v = tri[k];
+            output[3 * n + k] = v;
+            unsigned* a = &adjacent[offset[v]];
+            for (unsigned j = 0; j < live[v]; j++)
+                if (a[j] == (unsigned)best) {
+                    a[j] = a[live[v] - 1];
+                    break;
+                }
+            live[v]--;
+        }
+
+        // move the triangle's vertices to the front of the cache
+        unsigned newSize = 0;
+        for (unsigned k = 0; k < 3; k++)
+            newCache[newSize++] = tri[k];
+        for (unsigned j = 0; j < cacheSize; j++) {
+            unsigned v = cache[j];
+            if (v != tri[0] && v != tri[1] && v != tri[2])
+                newCache[newSize++] = v;
+        }
+
+        // rescore the cached vertices and those that dropped out
+        for (unsigned j = 0; j < newSize; j++) {
+            unsigned v = newCache[j];
+            int p = j < OPTIMIZE_CACHE_SIZE ? (int)j : -1;
+            float s = live[v] < MAX_VALENCE_SCORED ? valenceScore[live[v]] :
+             vertexScore(-1, live[v]);
+            if (live[v] && p >= 0) s += cacheScore[p];
+            float d = s - score[v];
+            score[v] = s;
+            for (unsigned i = 0; i < live[v]; i++)
+                triScore[adjacent[offset[v] + i]] += d;
+        }
+        cacheSize = newSize < OPTIMIZE_CACHE_SIZE ? newSize :
+         OPTIMIZE_CACHE_SIZE;
+        memcpy(cache, newCache, cacheSize * sizeof(unsigned));
+
+        // the best candidate is adjacent to a cached vertex
+        best = -1;
+        float bestScore = -1.0f;
+        for (unsigned j = 0; j < cacheSize; j++) {
+            unsigned v = cache[j];
+            for (unsigned i = 0; i < live[v]; i++) {
+                unsigned t = adjacent[offset[v] + i];
+                if (triScore[t] > bestScore) {
+                    bestScore = triScore[t];
+                    best = t;
+                }
+            }
+        }
+    }
+
+    memcpy(index, &output[0], nTriangles * 3 * sizeof(unsigned));
+}
+
+//-------------------------------- Overdraw -----------------------------------
+//
+// Cluster holds the sort metric of a run of triangles
+//
+struct Cluster {
+    unsigned first;  // first triangle in the cluster
+    unsigned count;  // number of triangles in the cluster
+    float    metric; // dot product of offset from the mesh centre and normal
+    bool operator<(const Cluster& c) const { return metric > c.metric; }
+};
+
+// optimizeOverdraw splits a cache-optimized list into clusters at points
+// where the cache restarts and reorders the clusters so that those facing
+// away from the centre of the mesh are drawn first - occluders then tend
+// to precede what they occlude - a split is accepted only if the ACMR up to
+// that point is within threshold of the ACMR of the whole list
+//
+void optimizeOverdraw(unsigned* index, unsigned nIndices,
+ const float* position, unsigned stride, unsigned nVertices,
+ float threshold) {
+
+    unsigned nTriangles = nIndices / 3;
+    if (nTriangles < 2 || !nVertices || !position) return;
+
+    const unsigned char* base = (const unsigned char*)position;
+    #define POS(v) ((const float*)(base + (v) * stride))
+
+    // hard boundaries - triangles whose three vertices all miss the cache
+    float limit = acmr(index, nTriangles * 3) * threshold;
+    std::vector<unsigned> fifo(VERTEX_CACHE_SIZE);
+    std::vector<unsigned> start;
+    unsigned head = 0, size = 0, misses = 0;
+    for (unsigned t = 0; t < nTriangles; t++) {
+        unsigned m = 0;
+        for (unsigned k = 0; k < 3; k++) {
+            unsigned v = index[3 * t + k];
+            bool hit = false;
+            for (unsigned j = 0; j < size && !hit; j++)
+                hit = fifo[j] == v;
+            if (!hit) {
+                m++;
+                fifo[head] = v;
+                head = (head + 1) % VERTEX_CACHE_SIZE;
+                if (size < VERTEX_CACHE_SIZE) size++;
+            }
+        }
+        if (t == 0 || (m == 3 && (float)misses / t <= limit))
+            start.push_back(t);
+        misses += m;
+    }
+    if (start.size() < 2) return;
+
+    // centre of the mesh - area weighted
+    float cx = 0, cy = 0, cz = 0, area = 0;
+    for (unsigned t = 0; t < nTriangles; t++) {
+        const float* a = POS(index[3 * t]);
+        const float* b = POS(index[3 * t + 1]);
+        const float* c = POS(index[3 * t + 2]);
+        float ux = b[0] - a[0], uy = b[1] - a[1], uz = b[2] - a[2];
+        float vx = c[0] - a[0], vy = c[1] - a[1], vz = c[2] - a[2];
+        float nx = uy * vz - uz * vy, ny = uz * vx - ux * vz,
+         nz = ux * vy - uy * vx;
+        float w = sqrtf(nx * nx + ny * ny + nz * nz);
+        cx += w * (a[0] + b[0] + c[0]) / 3;
+        cy += w * (a[1] + b[1] + c[1]) / 3;
+        cz += w * (a[2] + b[2] + c[2]) / 3;
+        area += w;
+    }
+    if (area > 0) {
+        cx /= area;
+        cy /= area;
+        cz /= area;
+    }
+
+    // metric for each cluster
+    std::vector<Cluster> cluster(start.size());
+    for (unsigned i = 0; i < start.size(); i++) {
+        unsigned last = i + 1 < start.size() ? start[i + 1] : nTriangles;
+        float px = 0, py = 0, pz = 0, nx = 0, ny = 0, nz = 0, w = 0;
+        for (unsigned t = start[i]; t < last; t++) {
+            const float* a = POS(index[3 * t]);
+            const float* b = POS(index[3 * t + 1]);
+            const float* c = POS(index[3 * t + 2]);
+            float ux = b[0] - a[0], uy = b[1] - a[1], uz = b[2] - a[2];
+            float vx = c[0] - a[0], vy = c[1] - a[1], vz = c[2] - a[2];
+            float tx = uy * vz - uz * vy, ty = uz * vx - ux * vz,
+             tz = ux * vy - uy * vx;
+            float ta = sqrtf(tx * tx + ty * ty + tz * tz);
+            px += ta * (a[0] + b[0] + c[0]) / 3;
+            py += ta * (a[1] + b[1] + c[1]) / 3;
+            pz += ta * (a[2] + b[2] + c[2]) / 3;
+            nx += tx;
+            ny += ty;
+            nz += tz;
+            w  += ta;
+        }
+        if (w > 0) {
+            px /= w;
+            py /= w;
+            pz /= w;
+        }
+        float len = sqrtf(nx * nx + ny * ny + nz * nz);
+        if (len > 0) {
+            nx /= len;
+            ny /= len;
+            nz /= len;
+        }
+        cluster[i].first  = start[i];
+        cluster[i].count  = last - start[i];
+        cluster[i].metric = (px - cx) * nx + (py - cy) * ny + (pz - cz) * nz;
+    }
+    #undef POS
+
+    std::stable_sort(cluster.begin(), cluster.end());
+
+    std::vector<unsigned> output(nTriangles * 3);
+    unsigned n = 0;
+    for (unsigned i = 0; i < cluster.size(); i++) {
+        memcpy(&output[n], &index[3 * cluster[i].first],
+         3 * cluster[i].count * sizeof(unsigned));
+        n += 3 * cluster[i].count;
+    }
+    memcpy(index, &output[0], nTriangles * 3 * sizeof(unsigned));
+}
+
+//-------------------------------- Vertex Fetch -------------------------------
+//
+// optimizeVertexFetch renumbers the vertices in the order in which the
+// index list first uses them so that the vertex buffer is read
+// sequentially - stores the new number of vertex v in remap[v] and rewrites
+// the indices - unreferenced vertices follow the referenced ones - returns
+// the number of referenced vertices
+//
+unsigned optimizeVertexFetch(unsigned* index, unsigned nIndices,
+ unsigned nVertices, unsigned* remap) {
+
+    const unsigned unused = ~0u;
+    for (unsigned v = 0; v < nVertices; v++)
+        remap[v] = unused;
+
+    unsigned next = 0;
+    for (unsigned i = 0; i < nIndices; i++) {
+        unsigned v = index[i];
+        if (remap[v] == unused)
+            remap[v] = next++;
+        index[i] = remap[v];
+    }
+    unsigned referenced = next;
+    for (unsigned v = 0; v < nVertices; v++)
+        if (remap[v] == unused)
+            remap[v] = next++;
+
+    return referenced;
+}
+
+//-------------------------------- Simplification -----------------------------
+//
+// Quadric holds the symmetric 4x4 matrix of the sum of the squared
+// distances to a set of planes - Garland and Heckbert's error metric
+//
+struct Quadric {
+    double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2;
+};
+
+// addPlane adds plane n.p + d = 0, weighted by w, to quadric q
+//
+static void addPlane(Quadric& q, double nx, double ny, double nz, double d,
+ double w) {
+
+    q.a2 += w * nx * nx; q.ab += w * nx * ny; q.ac += w * nx * nz;
+    q.ad += w * nx * d;  q.b2 += w * ny * ny; q.bc += w * ny * nz;
+    q.bd += w * ny * d;  q.c2 += w * nz * nz; q.cd += w * nz * d;
+    q.d2 += w * d * d;
+}
+
+// quadricError returns the error of the sum of quadrics q and r at p
+//
+static double quadricError(const Quadric& q, const Quadric& r,
+ const float* p) {
+
+    double x = p[0], y = p[1], z = p[2];
+    return (q.a2 + r.a2) * x * x + 2 * (q.ab + r.ab) * x * y +
+     2 * (q.ac + r.ac) * x * z + 2 * (q.ad + r.ad) * x +
+     (q.b2 + r.b2) * y * y + 2 * (q.bc + r.bc) * y * z +
+     2 * (q.bd + r.bd) * y + (q.c2 + r.c2) * z * z +
+     2 * (q.cd + r.cd) * z + q.d2 + r.d2;
+}
+
+// Collapse holds a candidate for moving vertex from onto vertex to
+//
+struct Collapse {
+    unsigned from;  // vertex that is removed
+    unsigned to;    // vertex that remains
+    double   error; // quadric error at the remaining vertex
+    bool operator<(const Collapse& c) const { return error < c.error; }
+};
+
+// Point holds the position of vertex v for finding shared positions
+//
+struct Point {
+    float    p[3]; // position
+    unsigned v;    // vertex number
+    bool operator<(const Point& q) const {
+        return p[0] < q.p[0] || (p[0] == q.p[0] && (p[1] < q.p[1] ||
+         (p[1] == q.p[1] && p[2] < q.p[2])));
+    }
+};
+
+// triangleNormal stores the unnormalized normal of triangle a b c in n
+//
+static void triangleNormal(const float* a, const float* b, const float* c,
+ double* n) {
+
+    double ux = b[0] - a[0], uy = b[1] - a[1], uz = b[2] - a[2];
+    double vx = c[0] - a[0], vy = c[1] - a[1], vz = c[2] - a[2];
+    n[0] = uy * vz - uz * vy;
+    n[1] = uz * vx - ux * vz;
+    n[2] = ux * vy - uy * vx;
+}
+
+// simplify reduces a triangle list to at most target indices by collapsing
+// edges onto one of their end points in order of increasing quadric error -
+// each pass collapses the cheapest independent edges and drops the
+// triangles that degenerate - vertices on an open boundary and vertices
+// that share their position with another vertex - texture or normal seams
+// - never move, and a collapse that would flip a triangle is rejected -
+// the vertices are not changed, so the kept indices address the original
+// vertex array - returns the number of indices kept
+//
+unsigned simplify(unsigned* index, unsigned nIndices, const float* position,
+ unsigned stride, unsigned nVertices, unsigned target) {
+
+    nIndices = nIndices / 3 * 3;
+    if (nIndices <= target || !nVertices || !position) return nIndices;
+
+    const unsigned char* base = (const unsigned char*)position;
+    #define POS(v) ((const float*)(base + (v) * stride))
+
+    // seams - vertices that share a position with another vertex
+    std::vector<bool> locked(nVertices, false);
+    std::vector<Point> point(nVertices);
+    for (unsigned v = 0; v < nVertices; v++) {
+        memcpy(point[v].p, POS(v), sizeof point[v].p);
+        point[v].v = v;
+    }
+    std::sort(point.begin(), point.end());
+    for (unsigned i = 1; i < nVertices; i++)
+        if (!memcmp(point[i - 1].p, point[i].p, sizeof point[i].p))
+            locked[point[i - 1].v] = locked[point[i].v] = true;
+    point.clear();
+
+    // open boundaries - edges used by only one triangle
+    std::vector<std::pair<unsigned, unsigned> > edge(nIndices);
+    for (unsigned i = 0; i < nIndices; i++) {
+        unsigned a = index[i], b = index[i % 3 == 2 ? i - 2 : i + 1];
+        edge[i] = a < b ? std::make_pair(a, b) : std::make_pair(b, a);
+    }
+    std::sort(edge.begin(), edge.end());
+    for (unsigned i = 0, j; i < nIndices; i = j) {
+        for (j = i + 1; j < nIndices && edge[j] == edge[i]; j++)
+            ;
+        if (j - i == 1)
+            locked[edge[i].first] = locked[edge[i].second] = true;
+    }
+    edge.clear();
+
+    // quadrics of the planes of the triangles about each vertex - area
+    // weighted
+    Quadric zero = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    std::vector<Quadric> quadric(nVertices, zero);
+    for (unsigned i = 0; i < nIndices; i += 3) {
+        const float* p = POS(index[i]);
+        double n[3];
+        triangleNormal(p, POS(index[i + 1]), POS(index[i + 2]), n);
+        double area = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (area > 0) {
+            n[0] /= area;
+            n[1] /= area;
+            n[2] /= area;
+            double d = -(n[0] * p[0] + n[1] * p[1] + n[2] * p[2]);
+            for (unsigned k = 0; k < 3; k++)
+                addPlane(quadric[index[i + k]], n[0], n[1], n[2], d,
+                 area / 2);
+        }
+    }
+
+    std::vector<unsigned> start(nVertices + 1), adjacent;
+    std::vector<Collapse> candidate;
+    std::vector<bool>     touched(nVertices);
+    bool progress = true;
+
+    while (nIndices > target && progress) {
+        progress = false;
+
+        // triangles about each vertex
+        std::fill(start.begin(), start.end(), 0);
+        for (unsigned i = 0; i < nIndices; i++)
+            start[index[i] + 1]++;
+        for (unsigned v = 0; v < nVertices; v++)
+            start[v + 1] += start[v];
+        adjacent.resize(nIndices);
+        std::vector<unsigned> fill(start.begin(), start.end() - 1);
+        for (unsigned i = 0; i < nIndices; i++)
+            adjacent[fill[index[i]]++] = i / 3;
+
+        // candidate collapses in order of increasing error
+        candidate.clear();
+        for (unsigned i = 0; i < nIndices; i++) {
+            unsigned a = index[i], b = index[i % 3 == 2 ? i - 2 : i + 1];
+            if (!locked[a]) {
+                Collapse c = {a, b, quadricError(quadric[a], quadric[b],
+                 POS(b))};
+                candidate.push_back(c);
+            }
+            if (!locked[b]) {
+                Collapse c = {b, a, quadricError(quadric[a], quadric[b],
+                 POS(a))};
+                candidate.push_back(c);
+            }
+        }
+        std::sort(candidate.begin(), candidate.end());
+
+        // collapse the cheapest edges whose neighbourhoods do not overlap
+        std::fill(touched.begin(), touched.end(), false);
+        unsigned live = nIndices / 3;
+        for (unsigned i = 0; i < candidate.size() && live * 3 > target; i++) {
+            unsigned a = candidate[i].from, b = candidate[i].to;
+            if (touched[a] || touched[b]) continue;
+
+            // reject the collapse if a surviving triangle would flip
+            bool flips = false;
+            unsigned removed = 0;
+            for (unsigned k = start[a]; k < start[a + 1] && !flips; k++) {
+                unsigned* t = &index[3 * adjacent[k]];
+                if (t[0] == b || t[1] == b || t[2] == b) {
+                    removed++;
+                    continue;
+                }
+                const float* p[3];
+                for (unsigned j = 0; j < 3; j++)
+                    p[j] = POS(t[j]);
+                double before[3], after[3];
+                triangleNormal(p[0], p[1], p[2], before);
+                for (unsigned j = 0; j < 3; j++)
+                    if (t[j] == a) p[j] = POS(b);
+                triangleNormal(p[0], p[1], p[2], after);
+                flips = before[0] * after[0] + before[1] * after[1] +
+                 before[2] * after[2] <= 0;
+            }
+            if (flips || !removed) continue;
+
+            // move a onto b and freeze the neighbourhood for this pass
+            for (unsigned k = start[a]; k < start[a + 1]; k++) {
+                unsigned* t = &index[3 * adjacent[k]];
+                for (unsigned j = 0; j < 3; j++) {
+                    if (t[j] == a) t[j] = b;
+                    touched[t[j]] = true;
+                }
+            }
+            for (unsigned k = start[b]; k < start[b + 1]; k++) {
+                const unsigned* t = &index[3 * adjacent[k]];
+                for (unsigned j = 0; j < 3; j++)
+                    touched[t[j]] = true;
+            }
+            touched[a] = true;
+            Quadric& q = quadric[b];
+            const Quadric& r = quadric[a];
+            q.a2 += r.a2; q.ab += r.ab; q.ac += r.ac; q.ad += r.ad;
+            q.b2 += r.b2; q.bc += r.bc; q.bd += r.bd; q.c2 += r.c2;
+            q.cd += r.cd; q.d2 += r.d2;
+            live -= removed;
+            progress = true;
+        }
+
+        // drop the degenerate triangles
+        unsigned n = 0;
+        for (unsigned i = 0; i < nIndices; i += 3) {
+            unsigned a = index[i], b = index[i + 1], c = index[i + 2];
+            if (a != b && b != c && c != a) {
+                index[n++] = a;
+                index[n++] = b;
+                index[n++] = c;
+            }
+        }
+        nIndices = n;
+    }
+    #undef POS
+
+    return nIndices;
+}
+
+//-------------------------------- Bounding Volume ----------------------------
+//
+// the bounding passes read each vertex as four floats - the fourth float
+// belongs to the next vertex or to the vertex's own attributes - so the
+// SSE passes transpose blocks of four vertices that are followed by at
+// least one more vertex and handle the remaining vertices one at a time
+//
+#ifdef BOUNDS_SSE
+// transpose loads the positions of the four vertices at p into x, y and z
+//
+static inline void transpose(const unsigned char* p, unsigned stride,
+ __m128& x, __m128& y, __m128& z) {
+
+    __m128 a = _mm_loadu_ps((const float*)p);
+    __m128 b = _mm_loadu_ps((const float*)(p + stride));
+    __m128 c = _mm_loadu_ps((const float*)(p + 2 * stride));
+    __m128 d = _mm_loadu_ps((const float*)(p + 3 * stride));
+    _MM_TRANSPOSE4_PS(a, b, c, d);
+    x = a;
+    y = b;
+    z = c;
+}
+#endif
+
+// squared returns the squared distance between points p and c
+//
+static inline float squared(const float* p, const float* c) {
+
+    float dx = p[0] - c[0], dy = p[1] - c[1], dz = p[2] - c[2];
+
+    return dx * dx + dy * dy + dz * dz;
+}
+
+// farthest returns the vertex that is farthest from point c and stores its
+// squared distance from c in d2
+//
+static unsigned farthest(const unsigned char* base, unsigned stride,
+ unsigned nVertices, const float* c, float& d2) {
+
+    unsigned i = 0, best = 0;
+    d2 = -1;
+    #ifdef BOUNDS_SSE
+    __m128 cx = _mm_set1_ps(c[0]), cy = _mm_set1_ps(c[1]), 
+     cz = _mm_set1_ps(c[2]);
+    for (; i + 4 < nVertices; i += 4) {
+        __m128 x, y, z;
+        transpose(base + i * stride, stride, x, y, z);
+        x = _mm_sub_ps(x, cx);
+        y = _mm_sub_ps(y, cy);
+        z = _mm_sub_ps(z, cz);
+        __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)),
+         _mm_mul_ps(z, z));
+        // the scalar scan runs only when the block holds a farther vertex
+        if (_mm_movemask_ps(_mm_cmpgt_ps(d, _mm_set1_ps(d2)))) {
+            float f[4];
+            _mm_storeu_ps(f, d);
+            for (unsigned k = 0; k < 4; k++)
+                if (f[k] > d2) {
+                    d2   = f[k];
+                    best = i + k;
+                }
+        }
+    }
+    #endif
+    for (; i < nVertices; i++) {
+        float d = squared((const float*)(base + i * stride), c);
+        if (d > d2) {
+            d2   = d;
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+// boundingVolume stores the bounding box of the vertices in minimum and
+// maximum and returns the radius of a near-minimal bounding sphere whose
+// centre it stores in centre - the sphere is Ritter's, grown to enclose
+// the outliers and then shrunk to the farthest vertex from its centre, or
+// the sphere about the centre of the box if that one is smaller
+//
+float boundingVolume(const float* position, unsigned stride,
+ unsigned nVertices, float* minimum, float* maximum, float* centre) {
+
+    for (unsigned k = 0; k < 3; k++)
+        minimum[k] = maximum[k] = centre[k] = 0;
+    if (!nVertices || !position) return 0;
+
+    const unsigned char* base = (const unsigned char*)position;
+    #define POS(v) ((const float*)(base + (v) * stride))
+
+    // bounding box
+    unsigned i = 0;
+    for (unsigned k = 0; k < 3; k++)
+        minimum[k] = maximum[k] = POS(0)[k];
+    #ifdef BOUNDS_SSE
+    if (nVertices > 4) {
+        __m128 nx, ny, nz;
+        transpose(base, stride, nx, ny, nz);
+        __m128 xx = nx, xy = ny, xz = nz;
+        for (i = 4; i + 4 < nVertices; i += 4) {
+            __m128 x, y, z;
+            transpose(base + i * stride, stride, x, y, z);
+            nx = _mm_min_ps(nx, x);
+            ny = _mm_min_ps(ny, y);
+            nz = _mm_min_ps(nz, z);
+            xx = _mm_max_ps(xx, x);
+            xy = _mm_max_ps(xy, y);
+            xz = _mm_max_ps(xz, z);
+        }
+        float f[6][4];
+        _mm_storeu_ps(f[0], nx);
+        _mm_storeu_ps(f[1], ny);
+        _mm_storeu_ps(f[2], nz);
+        _mm_storeu_ps(f[3], xx);
+        _mm_storeu_ps(f[4], xy);
+        _mm_storeu_ps(f[5], xz);
+        for (unsigned k = 0; k < 3; k++)
+            for (unsigned j = 0; j < 4; j++) {
+                if (f[k][j] < minimum[k])     minimum[k] = f[k][j];
+                if (f[k + 3][j] > maximum[k]) maximum[k] = f[k + 3][j];
+            }
+    }
+    #endif
+    for (; i < nVertices; i++)
+        for (unsigned k = 0; k < 3; k++) {
+            float f = POS(i)[k];
+            if (f < minimum[k]) minimum[k] = f;
+            if (f > maximum[k]) maximum[k] = f;
+        }
+
+    // Ritter's initial sphere spans the farthest vertex from the first
+    // vertex and the farthest vertex from that one
+    float d2;
+    unsigned a = farthest(base, stride, nVertices, POS(0), d2);
+    unsigned b = farthest(base, stride, nVertices, POS(a), d2);
+    float c[3], r = 0.5f * sqrtf(d2);
+    for (unsigned k = 0; k < 3; k++)
+        c[k] = 0.5f * (POS(a)[k] + POS(b)[k]);
+
+    // grow the sphere just enough to enclose each outlier
+    float r2 = r * r;
+    for (i = 0; i < nVertices; i++) {
+        const float* p = POS(i);
+        float d = squared(p, c);
+        if (d > r2) {
+            d = sqrtf(d);
+            float g = 0.5f * (r + d);
+            for (unsigned k = 0; k < 3; k++)
+                c[k] += (p[k] - c[k]) * (g - r) / d;
+            r  = g;
+            r2 = r * r;
+        }
+    }
+
+    // the radius that the vertices need about each candidate centre
+    float box[3];
+    for (unsigned k = 0; k < 3; k++)
+        box[k] = 0.5f * (minimum[k] + maximum[k]);
+    farthest(base, stride, nVertices, c, d2);
+    float ritter = sqrtf(d2);
+    farthest(base, stride, nVertices, box, d2);
+    float boxed = sqrtf(d2);
+    #undef POS
+
+    const float* best = ritter < boxed ? c : box;
+    for (unsigned k = 0; k < 3; k++)
+        centre[k] = best[k];
+
+    return ritter < boxed ? ritter : boxed;
+}
@@ -0,0 +1,52 @@
+#ifndef _MESH_OPTIMIZER_H_
+#define _MESH_OPTIMIZER_H_
+
+/* MeshOptimizer Declarations - Modelling Layer
+ *
+ * MeshOptimizer.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+// The mesh optimizer reorders and simplifies indexed triangle lists
+//
+// size of the FIFO post-transform cache assumed when measuring ACMR
+#define VERTEX_CACHE_SIZE   16
+// size of the LRU cache modelled while reordering triangles
+#define OPTIMIZE_CACHE_SIZE 32
+// largest increase in ACMR that overdraw ordering may cause
+#define OVERDRAW_THRESHOLD  1.05f
+
+// acmr returns the average number of cache misses per triangle
+float acmr(const unsigned* index, unsigned nIndices,
+ unsigned cacheSize = VERTEX_CACHE_SIZE);
+
+// optimizeVertexCache reorders the triangles for post-transform cache reuse
+void optimizeVertexCache(unsigned* index, unsigned nIndices,
+ unsigned nVertices);
+
+// optimizeOverdraw reorders clusters of triangles so that outward-facing
+// clusters are drawn first
+void optimizeOverdraw(unsigned* index, unsigned nIndices,
+ const float* position, unsigned stride, unsigned nVertices,
+ float threshold = OVERDRAW_THRESHOLD);
+
+// optimizeVertexFetch renumbers the vertices in order of first use
+unsigned optimizeVertexFetch(unsigned* index, unsigned nIndices,
+ unsigned nVertices, unsigned* remap);
+
+// simplify collapses edges of a triangle list until at most target indices
+// remain - returns the number of indices kept
+unsigned simplify(unsigned* index, unsigned nIndices, const float* position,
+ unsigned stride, unsigned nVertices, unsigned target);
+
+// boundingVolume stores the bounding box of the vertices in minimum and
+// maximum and the centre of a near-minimal bounding sphere in centre -
+// returns the radius of that sphere
+float boundingVolume(const float* position, unsigned stride,
+ unsigned nVertices, float* minimum, float* maximum, float* centre);
+
+#endif
@@ -1,98 +1,165 @@
-#ifndef _MODELLING_LAYER_H_
-#define _MODELLING_LAYER_H_
-
-/* Internal Settings local to the Modelling Layer
- *
- * ModellingLayer.h
- * fwk4gps version 3.0
- * gam666/dps901/gam670/dps905
- * January 14 2012
- * copyright (c) 2012 Chris Szalwinski 
- * distributed under TPL - see ../Licenses.txt
- */
-
-#include "GeneralConstants.h" // framework-wide configuration settings
-
-// File Directories
-#define AUDIO_DIRECTORY   L"..\\..\\resources\\audio"
-#define TEXTURE_DIRECTORY L"..\\..\\resources\\textures"
-#define ASSET_DIRECTORY   L"..\\..\\resources\\assets"
-
-// Timing Factors
-//
-// fps maximum - should be > flicker fusion threshold
-#define FPS_MAX          200
-// latency - keystroke time interval 
-#define KEY_LATENCY     (unitsPerSec / 2)
-
-// camera settings
-//
-// camera speed control factors
-#define CAM_SPEED       0.02f
-#define TURNING_RADIUS  120.00f
-#define ANG_CAM_SPEED   ( CAM_SPEED / TURNING_RADIUS )
-
-// frame motion parameters
-//
-// factors applied to the time interval
-#define FORWARD_SPEED 10.0f / unitsPerSec
-#define ROT_SPEED     0.03f * FORWARD_SPEED
-#define CONSTANT_ROLL 10.0f * ROT_SPEED
-
-// input device motion conversion factors - 
-//
-// mouse motion conversion factors
-#define MOUSE_SPEED             10
-#define POINTER_SCALE           10
-// controller conversion factors
-#define CTR_SPEED               0.05f
-#define CTR_DISPLACEMENT_FACTOR 0.015f 
-#define CTR_ROTATION_FACTOR     0.015f 
-
-// audio controls
-//
-// initial volume settings
-#define MIN_VOLUME		    0
-#define DEFAULT_VOLUME	  500
-#define MAX_VOLUME	     1000
-#define STEP_VOLUME         1
-// initial frequency settings
-#define MIN_FREQUENCY	    0
-#define DEFAULT_FREQUENCY 500
-#define MAX_FREQUENCY    1000
-#define STEP_FREQUENCY		1
-
-// foreground texture transparency [\x00,\xff]
-#define TEXTURE_ALPHA '\x20'
-
-// hud and text controls
-//
-// hud background image
-#define HUD_IMAGE L"hudBackground.bmp"
-// relative limits on the size of the hud [0,1]
-#define HUD_MAX    0.99f
-#define HUD_MIN    0.01f
-#define HUD_SPEED  (0.5f /* screen units per sec */ / unitsPerSec) 
-// hud location within window [0,1]
-#define HUD_W     0.43f
-#define HUD_H     0.43f
-// text limits within the hud [0,1]
-#define TEXT_MAX   0.99f
-#define TEXT_MIN   0.01f
-
-// Text status
-#define TEXT_ON  L" + " // symbol for on
-#define TEXT_OFF L" o " // symbol for off
-
-// Coordinator categories
-//
-typedef enum Category {
-    OPAQUE_OBJECT,
-    TRANSLUCENT_OBJECT,
-    TEST_COLOUR,
-    ALL_OBJECTS,
-    ALL_HUDS,
-    ALL_SOUNDS,
-} Category;
-
-#endif
+#ifndef _MODELLING_LAYER_H_
+#define _MODELLING_LAYER_H_
+
+/* Internal Settings local to the Modelling Layer
+ *
+ * ModellingLayer.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "GeneralConstants.h" // framework-wide configuration settings
+
+// File Directories
+#define AUDIO_DIRECTORY   L"..\\..\\resources\\audio"
+#define TEXTURE_DIRECTORY L"..\\..\\resources\\textures"
+#define ASSET_DIRECTORY   L"..\\..\\resources\\assets"
+
+// Asynchronous Loading
+//
+// worker threads - 0 for one less than the number of hardware threads
+#define ASSET_THREADS  0
+// most loaded assets handed to the main thread in a single frame
+#define ASSET_HANDOFFS 8
+
+// Prewarming
+//
+// milliseconds per frame spent creating API resources ahead of their first
+// use after initialization and after each restore
+#define PREWARM_BUDGET 4
+
+// Terrain
+//
+// quads along each side of a terrain chunk - the heightmap must have 
+// TERRAIN_CHUNK * 2^k + 1 samples along each side
+#define TERRAIN_CHUNK    32
+// a chunk is split into four finer chunks while the camera is closer to it
+// than this many chunk widths
+#define TERRAIN_LOD      1.5f
+// depth of the skirt hung from each chunk edge, in sample spacings of the 
+// chunk
+#define TERRAIN_SKIRT    2.0f
+// most chunk meshes requested from the asset workers in a single frame
+#define TERRAIN_REQUESTS 4
+// frames that a chunk mesh stays resident after it was last needed
+#define TERRAIN_EVICT    120
+
+// Workers
+//
+// threads shared by the particle and skinning passes - 0 for one less than
+// the number of hardware threads
+#define WORKER_THREADS    0
+
+// Particles
+//
+// particles integrated or expanded by a single task - smaller systems are
+// updated on the main thread alone
+#define PARTICLE_SLICE    16384
+// longest step in seconds that a single update integrates
+#define PARTICLE_MAX_STEP 0.1f
+
+// Skinning
+//
+// vertices skinned by a single task - smaller skins are skinned on the main
+// thread alone
+#define SKIN_SLICE        4096
+
+// Animation
+//
+// longest step in seconds that a single update advances a clip - keeps
+// clips from jumping after the application has been suspended
+#define ANIMATION_MAX_STEP 0.25f
+
+// Timing Factors
+//
+// fps maximum - should be > flicker fusion threshold
+#define FPS_MAX          200
+// latency - keystroke time interval 
+#define KEY_LATENCY     (unitsPerSec / 2)
+
+// camera settings
+//
+// camera speed control factors
+#define CAM_SPEED       0.02f
+#define TURNING_RADIUS  120.00f
+#define ANG_CAM_SPEED   ( CAM_SPEED / TURNING_RADIUS )
+
+// frame motion parameters
+//
+// factors applied to the time interval
+#define FORWARD_SPEED 10.0f / unitsPerSec
+#define ROT_SPEED     0.03f * FORWARD_SPEED
+#define CONSTANT_ROLL 10.0f * ROT_SPEED
+
+// input device motion conversion factors - 
+//
+// mouse motion conversion factors
+#define MOUSE_SPEED             10
+#define POINTER_SCALE           10
+// controller conversion factors
+#define CTR_SPEED               0.05f
+#define CTR_DISPLACEMENT_FACTOR 0.015f 
+#define CTR_ROTATION_FACTOR     0.015f 
+
+// audio controls
+//
+// initial volume settings
+#define MIN_VOLUME		    0
+#define DEFAULT_VOLUME	  500
+#define MAX_VOLUME	     1000
+#define STEP_VOLUME         1
+// initial frequency settings
+#define MIN_FREQUENCY	    0
+#define DEFAULT_FREQUENCY 500
+#define MAX_FREQUENCY    1000
+#define STEP_FREQUENCY		1
+
+// foreground texture transparency [\x00,\xff]
+#define TEXTURE_ALPHA '\x20'
+
+// hud and text controls
+//
+// hud background image
+#define HUD_IMAGE L"hudBackground.bmp"
+// relative limits on the size of the hud [0,1]
+#define HUD_MAX    0.99f
+#define HUD_MIN    0.01f
+#define HUD_SPEED  (0.5f /* screen units per sec */ / unitsPerSec) 
+// hud location within window [0,1]
+#define HUD_W     0.43f
+#define HUD_H     0.43f
+// text limits within the hud [0,1]
+#define TEXT_MAX   0.99f
+#define TEXT_MIN   0.01f
+
+// Text status
+#define TEXT_ON  L" + " // symbol for on
+#define TEXT_OFF L" o " // symbol for off
+
+// Coordinator categories
+//
+typedef enum Category {
+    OPAQUE_OBJECT,
+    TRANSLUCENT_OBJECT,
+    TEST_COLOUR,
+    ALL_OBJECTS,
+    ALL_EMITTERS,
+    ALL_HUDS,
+    ALL_SOUNDS,
+} Category;
+
+// number of drawing categories that hold objects - the Coordinator keeps
+// one bucket of objects for each of the first OBJECT_CATEGORIES categories
+#define OBJECT_CATEGORIES (TRANSLUCENT_OBJECT + 1)
+
+// static batching - maximum number of primitives merged into one batch
+#define MAX_BATCH_PRIMITIVES 65535
+
+// level of detail - fraction of a switching distance that the camera must
+// pass beyond it before an object changes level
+#define LOD_HYSTERESIS 0.1f
+
+#endif
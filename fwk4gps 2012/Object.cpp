@@ -1,119 +1,182 @@
-/* Object Implementation - Modelling Layer
- *
- * Object.cpp
- * fwk4gps version 3.0
- * gam666/dps901/gam670/dps905
- * January 14 2012
- * copyright (c) 2012 Chris Szalwinski 
- * distributed under TPL - see ../Licenses.txt
- */
-
-#include "iCoordinator.h"   // for the Coordinator Interface
-#include "iGraphic.h"       // for the Graphic Interface
-#include "iTexture.h"       // for the Texture Interface
-#include "iUtilities.h"     // for error()
-
-#include "Object.h"         // for the Object class definition
-#include "ModellingLayer.h" // for Category symbols
-#include "Common_Symbols.h" // symbols common to Modelling/Translation layers
-
-//-------------------------------- Object -------------------------------------
-//
-// The Object class defines the structure of a single object in the model
-//
-iObject* CreateObject(iGraphic* v, const Reflectivity* r) {
-
-    return new Object(TEST_COLOUR, v, r);
-}
-
-// Clone create a clone of Object* src and returns its address
-//
-iObject* Clone(const iObject* src) {
-
-    return (iObject*)src->clone();
-}
-
-// constructor initializes an object with material reflectivity *r
-//
-Object::Object(Category d, iGraphic* v, const Reflectivity* r) : category(d),
- graphic(v), texture(0), flags(TEX_DEFAULT) {
-    
-    coordinator->add(this);
-
-    // store reflectivity and texture pointer
-    if (r) {
-        reflectivity = new Reflectivity;
-        *reflectivity = *r;
-
-        // specialize category for translucency only if TEST_COLOUR
-        if (category == TEST_COLOUR) {
-            category = OPAQUE_OBJECT;
-            if (reflectivity->translucent())
-                category = TRANSLUCENT_OBJECT;
-        }
-    }
-    else {
-        category = OPAQUE_OBJECT;
-        reflectivity = nullptr;
-    }
-}
-
-// copy constructor initializes the instance pointer and calls the assignment
-// operator
-//
-Object::Object(const Object& src) {
-
-    coordinator->add(this);
-    reflectivity = nullptr;
-    *this = src;
-}
-            
-// assignment operator discards old data and creates a copy from
-// src - does not copy the text items attached to src - instead 
-// initializes them to nullptr
-//
-Object& Object::operator=(const Object& src) {
-
-    if (this != &src) {
-        *((iObject*)this) = src;
-        if (reflectivity) 
-            delete reflectivity;
-        if (src.reflectivity) {
-            reflectivity  = new Reflectivity;
-            *reflectivity = *src.reflectivity;
-        }
-        else
-            reflectivity = nullptr;
-        category     = src.category;
-        graphic      = src.graphic; 
-        flags        = src.flags;
-        texture      = src.texture;
-    }
-
-    return *this;
-}
-
-// attach attaches texture *t to the object
-//
-void Object::attach(iTexture* t) {
-
-    texture = t;
-}
-
-// render draws the object
-//
-void Object::render() { 
-	
-    if (texture && flags) texture->setFilter(flags);
-    if (graphic) graphic->render();
-}
-
-// destructor removes the object from the model coordinator
-//
-Object::~Object() {
-
-    coordinator->remove(this);
-    if (reflectivity)
-        delete reflectivity;
-}
-
+/* Object Implementation - Modelling Layer
+ *
+ * Object.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "iCoordinator.h"   // for the Coordinator Interface
+#include "iGraphic.h"       // for the Graphic Interface
+#include "iTexture.h"       // for the Texture Interface
+#include "iUtilities.h"     // for error()
+
+#include "Object.h"         // for the Object class definition
+#include "ModellingLayer.h" // for Category symbols
+#include "Common_Symbols.h" // symbols common to Modelling/Translation layers
+
+//-------------------------------- Object -------------------------------------
+//
+// The Object class defines the structure of a single object in the model
+//
+iObject* CreateObject(iGraphic* v, const Reflectivity* r) {
+
+    return new Object(TEST_COLOUR, v, r);
+}
+
+// Clone create a clone of Object* src and returns its address
+//
+iObject* Clone(const iObject* src) {
+
+    return (iObject*)src->clone();
+}
+
+// GenerateLODs adds levels of detail to object *o, each simplified from the
+// one before it to about ratio of its triangles - the first added level 
+// starts at distance and each further level at twice the distance of the
+// one before it - stops early if the graphic cannot be simplified further
+//
+void GenerateLODs(iObject* o, unsigned levels, float distance, float ratio) {
+
+    const iGraphic* g = o ? o->getGraphic() : nullptr;
+
+    for (unsigned i = 0; g && i < levels; i++, distance *= 2) {
+        iGraphic* lod = g->simplify(ratio);
+        if (lod) o->addLOD(lod, distance);
+        g = lod;
+    }
+}
+
+// constructor initializes an object with material reflectivity *r - the
+// object takes its boundary from graphic v until one is set by hand
+//
+Object::Object(Category d, iGraphic* v, const Reflectivity* r) : category(d),
+ graphic(v), texture(0), flags(TEX_DEFAULT), stationary(false), current(0) {
+
+    level.push_back(v);
+    from.push_back(0);
+    setBounds(v);
+    
+    // store reflectivity and texture pointer
+    if (r) {
+        reflectivity = new Reflectivity;
+        *reflectivity = *r;
+
+        // specialize category for translucency only if TEST_COLOUR
+        if (category == TEST_COLOUR) {
+            category = OPAQUE_OBJECT;
+            if (reflectivity->translucent())
+                category = TRANSLUCENT_OBJECT;
+        }
+    }
+    else {
+        category = OPAQUE_OBJECT;
+        reflectivity = nullptr;
+    }
+
+    // add once the category is known so that the coordinator files the 
+    // object in the bucket for its category
+    coordinator->add(this);
+}
+
+// copy constructor initializes the instance pointer and calls the assignment
+// operator
+//
+Object::Object(const Object& src) : category(src.category) {
+
+    coordinator->add(this);
+    reflectivity = nullptr;
+    *this = src;
+}
+            
+// assignment operator discards old data and creates a copy from
+// src - does not copy the text items attached to src - instead 
+// initializes them to nullptr
+//
+Object& Object::operator=(const Object& src) {
+
+    if (this != &src) {
+        *((iObject*)this) = src;
+        if (reflectivity) 
+            delete reflectivity;
+        if (src.reflectivity) {
+            reflectivity  = new Reflectivity;
+            *reflectivity = *src.reflectivity;
+        }
+        else
+            reflectivity = nullptr;
+        graphic      = src.graphic; 
+        flags        = src.flags;
+        texture      = src.texture;
+        stationary   = src.stationary;
+        level        = src.level;
+        from         = src.from;
+        current      = src.current;
+        // refile the object if its drawing category has changed
+        if (category != src.category) {
+            category = src.category;
+            coordinator->categorize(this);
+        }
+    }
+
+    return *this;
+}
+
+// attach attaches texture *t to the object
+//
+void Object::attach(iTexture* t) {
+
+    texture = t;
+}
+
+// addLOD adds graphic *g as the level of detail drawn from distance d
+// onwards - the levels are kept in order of distance
+//
+void Object::addLOD(iGraphic* g, float d) {
+
+    if (!g || d <= 0) return;
+
+    unsigned i = 1;
+    while (i < from.size() && from[i] <= d)
+        i++;
+    level.insert(level.begin() + i, g);
+    from.insert(from.begin() + i, d);
+    if (current >= i) current++;
+}
+
+// selectLOD selects the level of detail for a camera at distance d - the
+// camera must pass a switching distance by LOD_HYSTERESIS of it before the
+// level changes, so that an object near a threshold does not flicker
+// between levels
+//
+void Object::selectLOD(float d) {
+
+    unsigned c = current;
+
+    while (c + 1 < level.size() && d > from[c + 1] * (1 + LOD_HYSTERESIS))
+        c++;
+    while (c > 0 && d < from[c] * (1 - LOD_HYSTERESIS))
+        c--;
+    current = c;
+    graphic = level[c];
+}
+
+// render draws the object
+//
+void Object::render() { 
+	
+    if (texture && flags) texture->setFilter(flags);
+    if (graphic) graphic->render();
+}
+
+// destructor removes the object from the model coordinator
+//
+Object::~Object() {
+
+    coordinator->remove(this);
+    if (reflectivity)
+        delete reflectivity;
+}
+
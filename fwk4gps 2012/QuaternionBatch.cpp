@@ -0,0 +1,314 @@
+/* Batched Quaternion Functions
+ *
+ * QuaternionBatch.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "QuaternionBatch.h" // for QuaternionArrays and QUATERNION_LANES
+#include "MathDefinitions.h" // for the single quaternion functions
+
+//-------------------------------- Lanes --------------------------------------
+//
+// Lanes holds one component of QUATERNION_LANES quaternions - the helpers
+// below are the only instructions that the batch functions use
+//
+#if QUATERNION_LANES == 8
+#include <immintrin.h>       // for the AVX intrinsics
+
+typedef __m256 Lanes;
+
+static inline Lanes load(const float* p)     { return _mm256_loadu_ps(p); }
+static inline void  store(float* p, Lanes a) { _mm256_storeu_ps(p, a); }
+static inline Lanes splat(float f)           { return _mm256_set1_ps(f); }
+static inline Lanes add(Lanes a, Lanes b)    { return _mm256_add_ps(a, b); }
+static inline Lanes sub(Lanes a, Lanes b)    { return _mm256_sub_ps(a, b); }
+static inline Lanes mul(Lanes a, Lanes b)    { return _mm256_mul_ps(a, b); }
+static inline Lanes sign(Lanes a) {
+    return _mm256_and_ps(a, _mm256_set1_ps(-0.0f));
+}
+static inline Lanes flip(Lanes a, Lanes s)   { return _mm256_xor_ps(a, s); }
+static inline Lanes rsqrt(Lanes a)           { return _mm256_rsqrt_ps(a); }
+static inline Lanes less(Lanes a, Lanes b) {
+    return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+}
+static inline Lanes select(Lanes m, Lanes a, Lanes b) {
+    return _mm256_blendv_ps(b, a, m);
+}
+#elif QUATERNION_LANES == 4
+#include <xmmintrin.h>       // for the SSE intrinsics
+
+typedef __m128 Lanes;
+
+static inline Lanes load(const float* p)     { return _mm_loadu_ps(p); }
+static inline void  store(float* p, Lanes a) { _mm_storeu_ps(p, a); }
+static inline Lanes splat(float f)           { return _mm_set1_ps(f); }
+static inline Lanes add(Lanes a, Lanes b)    { return _mm_add_ps(a, b); }
+static inline Lanes sub(Lanes a, Lanes b)    { return _mm_sub_ps(a, b); }
+static inline Lanes mul(Lanes a, Lanes b)    { return _mm_mul_ps(a, b); }
+static inline Lanes sign(Lanes a) {
+    return _mm_and_ps(a, _mm_set1_ps(-0.0f));
+}
+static inline Lanes flip(Lanes a, Lanes s)   { return _mm_xor_ps(a, s); }
+static inline Lanes rsqrt(Lanes a)           { return _mm_rsqrt_ps(a); }
+static inline Lanes less(Lanes a, Lanes b)   { return _mm_cmplt_ps(a, b); }
+static inline Lanes select(Lanes m, Lanes a, Lanes b) {
+    return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+}
+#endif
+
+#if QUATERNION_LANES > 1
+// loadLanes loads quaternions i to i + QUATERNION_LANES - 1 of a into q
+//
+static inline void loadLanes(const QuaternionArrays& a, unsigned i,
+ Lanes* q) {
+
+    q[0] = load(a.x + i);
+    q[1] = load(a.y + i);
+    q[2] = load(a.z + i);
+    q[3] = load(a.w + i);
+}
+
+// storeLanes stores q as quaternions i to i + QUATERNION_LANES - 1 of r
+//
+static inline void storeLanes(const QuaternionArrays& r, unsigned i,
+ const Lanes* q) {
+
+    store(r.x + i, q[0]);
+    store(r.y + i, q[1]);
+    store(r.z + i, q[2]);
+    store(r.w + i, q[3]);
+}
+
+// dot returns the dot products of a and b
+//
+static inline Lanes dot(const Lanes* a, const Lanes* b) {
+
+    return add(add(mul(a[0], b[0]), mul(a[1], b[1])),
+     add(mul(a[2], b[2]), mul(a[3], b[3])));
+}
+
+// normalize scales q to unit length - the reciprocal square root estimate
+// is refined by one Newton step - a zero q becomes the identity, as in
+// normal()
+//
+static inline void normalize(Lanes* q) {
+
+    Lanes l = dot(q, q);
+    Lanes y = rsqrt(l);
+    y = mul(y, sub(splat(1.5f), mul(mul(splat(0.5f), l), mul(y, y))));
+    Lanes n = less(splat(0), l);
+    for (unsigned c = 0; c < 4; c++)
+        q[c] = select(n, mul(q[c], y), splat(c == 3 ? 1.f : 0.f));
+}
+
+// weight returns the slerp weight sin(t a) / sin(a) of a key by the series
+// in cos(a) - 1 of Eberly's "A Fast and Accurate Algorithm for Computing
+// SLERP" - the last term is scaled to absorb the truncated ones, which
+// holds the weight to within 1e-6 for angles up to pi / 2
+//
+static const float slerpU[] = {1.f / 3, 1.f / 10, 1.f / 21, 1.f / 36,
+ 1.f / 55, 1.f / 78, 1.f / 105, 1.f / 136, 1.f / 171, 1.f / 210, 1.f / 253,
+ 1.894f / 300};
+static const float slerpV[] = {1.f / 3, 2.f / 5, 3.f / 7, 4.f / 9,
+ 5.f / 11, 6.f / 13, 7.f / 15, 8.f / 17, 9.f / 19, 10.f / 21, 11.f / 23,
+ 1.894f * 12 / 25};
+
+static inline Lanes weight(Lanes t, Lanes xm1) {
+
+    Lanes tt = mul(t, t);
+    Lanes c  = splat(1);
+    for (int i = sizeof slerpU / sizeof slerpU[0] - 1; i >= 0; i--)
+        c = add(splat(1), mul(mul(sub(mul(splat(slerpU[i]), tt),
+         splat(slerpV[i])), xm1), c));
+    return mul(t, c);
+}
+
+// slerpLanes interpolates a and b by t along the shorter arc into r
+//
+static inline void slerpLanes(const Lanes* a, const Lanes* b, Lanes t,
+ Lanes* r) {
+
+    Lanes d   = dot(a, b);
+    Lanes s   = sign(d);
+    Lanes xm1 = sub(flip(d, s), splat(1));
+    Lanes wa  = weight(sub(splat(1), t), xm1);
+    Lanes wb  = flip(weight(t, xm1), s);
+    for (unsigned c = 0; c < 4; c++)
+        r[c] = add(mul(wa, a[c]), mul(wb, b[c]));
+}
+#endif
+
+// quaternionAt returns quaternion i of a
+//
+static inline Quaternion quaternionAt(const QuaternionArrays& a,
+ unsigned i) {
+
+    return Quaternion(a.x[i], a.y[i], a.z[i], a.w[i]);
+}
+
+// storeAt stores q as quaternion i of r
+//
+static inline void storeAt(const QuaternionArrays& r, unsigned i,
+ const Quaternion& q) {
+
+    r.x[i] = q.x;
+    r.y[i] = q.y;
+    r.z[i] = q.z;
+    r.w[i] = q.w;
+}
+
+//-------------------------------- Batch Functions ----------------------------
+//
+// multiply stores in r the products a * b
+//
+void multiply(const QuaternionArrays& a, const QuaternionArrays& b,
+ const QuaternionArrays& r, unsigned n) {
+
+    unsigned i = 0;
+    #if QUATERNION_LANES > 1
+    for (; i + QUATERNION_LANES <= n; i += QUATERNION_LANES) {
+        Lanes p[4], q[4], m[4];
+        loadLanes(a, i, p);
+        loadLanes(b, i, q);
+        m[0] = sub(add(add(mul(q[3], p[0]), mul(q[0], p[3])),
+         mul(q[1], p[2])), mul(q[2], p[1]));
+        m[1] = sub(add(add(mul(q[3], p[1]), mul(q[1], p[3])),
+         mul(q[2], p[0])), mul(q[0], p[2]));
+        m[2] = sub(add(add(mul(q[3], p[2]), mul(q[2], p[3])),
+         mul(q[0], p[1])), mul(q[1], p[0]));
+        m[3] = sub(sub(sub(mul(q[3], p[3]), mul(q[0], p[0])),
+         mul(q[1], p[1])), mul(q[2], p[2]));
+        storeLanes(r, i, m);
+    }
+    #endif
+    for (; i < n; i++)
+        storeAt(r, i, quaternionAt(a, i) * quaternionAt(b, i));
+}
+
+// conjugate stores in r the conjugates of a
+//
+void conjugate(const QuaternionArrays& a, const QuaternionArrays& r,
+ unsigned n) {
+
+    for (unsigned i = 0; i < n; i++) {
+        r.x[i] = -a.x[i];
+        r.y[i] = -a.y[i];
+        r.z[i] = -a.z[i];
+        r.w[i] =  a.w[i];
+    }
+}
+
+// rotate stores in (rx, ry, rz) the vectors (vx, vy, vz) rotated by the
+// unit quaternions in q
+//
+void rotate(const float* vx, const float* vy, const float* vz,
+ const QuaternionArrays& q, float* rx, float* ry, float* rz, unsigned n) {
+
+    unsigned i = 0;
+    #if QUATERNION_LANES > 1
+    for (; i + QUATERNION_LANES <= n; i += QUATERNION_LANES) {
+        Lanes p[4], x = load(vx + i), y = load(vy + i), z = load(vz + i);
+        loadLanes(q, i, p);
+        // t = 2 q x v, r = v + w t + q x t
+        Lanes two = splat(2);
+        Lanes tx  = mul(two, sub(mul(p[1], z), mul(p[2], y)));
+        Lanes ty  = mul(two, sub(mul(p[2], x), mul(p[0], z)));
+        Lanes tz  = mul(two, sub(mul(p[0], y), mul(p[1], x)));
+        store(rx + i, add(add(x, mul(p[3], tx)),
+         sub(mul(p[1], tz), mul(p[2], ty))));
+        store(ry + i, add(add(y, mul(p[3], ty)),
+         sub(mul(p[2], tx), mul(p[0], tz))));
+        store(rz + i, add(add(z, mul(p[3], tz)),
+         sub(mul(p[0], ty), mul(p[1], tx))));
+    }
+    #endif
+    for (; i < n; i++) {
+        Vector v = Vector(vx[i], vy[i], vz[i]) * quaternionAt(q, i);
+        rx[i] = v.x;
+        ry[i] = v.y;
+        rz[i] = v.z;
+    }
+}
+
+// nlerp stores in r the normalized blends of a and b by fractions t along
+// the shorter arcs
+//
+void nlerp(const QuaternionArrays& a, const QuaternionArrays& b,
+ const float* t, const QuaternionArrays& r, unsigned n) {
+
+    unsigned i = 0;
+    #if QUATERNION_LANES > 1
+    for (; i + QUATERNION_LANES <= n; i += QUATERNION_LANES) {
+        Lanes p[4], q[4], m[4], u = load(t + i);
+        loadLanes(a, i, p);
+        loadLanes(b, i, q);
+        Lanes s  = sub(splat(1), u);
+        Lanes ub = flip(u, sign(dot(p, q)));
+        for (unsigned c = 0; c < 4; c++)
+            m[c] = add(mul(s, p[c]), mul(ub, q[c]));
+        normalize(m);
+        storeLanes(r, i, m);
+    }
+    #endif
+    for (; i < n; i++)
+        storeAt(r, i, nlerp(quaternionAt(a, i), quaternionAt(b, i), t[i]));
+}
+
+// slerp stores in r the interpolations of a and b by fractions t along
+// the shorter arcs
+//
+void slerp(const QuaternionArrays& a, const QuaternionArrays& b,
+ const float* t, const QuaternionArrays& r, unsigned n) {
+
+    unsigned i = 0;
+    #if QUATERNION_LANES > 1
+    for (; i + QUATERNION_LANES <= n; i += QUATERNION_LANES) {
+        Lanes p[4], q[4], m[4];
+        loadLanes(a, i, p);
+        loadLanes(b, i, q);
+        slerpLanes(p, q, load(t + i), m);
+        storeLanes(r, i, m);
+    }
+    #endif
+    for (; i < n; i++)
+        storeAt(r, i, slerp(quaternionAt(a, i), quaternionAt(b, i), t[i]));
+}
+
+// squad stores in r the squad interpolations of a and b by fractions t
+// with control quaternions sa and sb
+//
+void squad(const QuaternionArrays& a, const QuaternionArrays& b,
+ const QuaternionArrays& sa, const QuaternionArrays& sb, const float* t,
+ const QuaternionArrays& r, unsigned n) {
+
+    unsigned i = 0;
+    #if QUATERNION_LANES > 1
+    for (; i + QUATERNION_LANES <= n; i += QUATERNION_LANES) {
+        Lanes p[4], q[4], ab[4], sab[4], m[4], u = load(t + i);
+        loadLanes(a, i, p);
+        loadLanes(b, i, q);
+        slerpLanes(p, q, u, ab);
+        // the controls blend through their midpoint - see squad
+        loadLanes(sa, i, p);
+        loadLanes(sb, i, q);
+        for (unsigned c = 0; c < 4; c++)
+            m[c] = add(p[c], q[c]);
+        normalize(m);
+        Lanes h = less(u, splat(0.5f)), v = add(u, u);
+        for (unsigned c = 0; c < 4; c++) {
+            q[c] = select(h, m[c], q[c]);
+            p[c] = select(h, p[c], m[c]);
+        }
+        slerpLanes(p, q, select(h, v, sub(v, splat(1))), sab);
+        slerpLanes(ab, sab, mul(mul(splat(2), u), sub(splat(1), u)), m);
+        storeLanes(r, i, m);
+    }
+    #endif
+    for (; i < n; i++)
+        storeAt(r, i, squad(quaternionAt(a, i), quaternionAt(b, i),
+         quaternionAt(sa, i), quaternionAt(sb, i), t[i]));
+}
@@ -0,0 +1,66 @@
+#ifndef _QUATERNION_BATCH_H_
+#define _QUATERNION_BATCH_H_
+
+/* Batched Quaternion Functions
+ *
+ * QuaternionBatch.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+//-------------------------------- QuaternionArrays ---------------------------
+//
+// QuaternionArrays holds n quaternions as separate arrays of each component
+// so that the batch functions process QUATERNION_LANES quaternions at a
+// time - 8 with AVX, 4 with SSE - and the rest one at a time
+//
+// each function processes quaternions 0 to n - 1 of its arguments and
+// stores its results in r, which may be one of the arguments - the batch
+// results match the single quaternion functions of the same name to
+// within rounding, except that slerp uses a polynomial for the blend
+// weights that is accurate to within 1e-6
+//
+#if defined(__AVX__)
+#define QUATERNION_LANES 8
+#elif defined(_M_IX86) || defined(_M_X64) || defined(__SSE__)
+#define QUATERNION_LANES 4
+#else
+#define QUATERNION_LANES 1
+#endif
+
+struct QuaternionArrays {
+    float* x;
+    float* y;
+    float* z;
+    float* w;
+};
+
+// r = a * b - rotates by a and then by b
+void multiply(const QuaternionArrays& a, const QuaternionArrays& b,
+ const QuaternionArrays& r, unsigned n);
+
+// r = conjugate of a
+void conjugate(const QuaternionArrays& a, const QuaternionArrays& r,
+ unsigned n);
+
+// (rx, ry, rz) = (vx, vy, vz) rotated by q
+void rotate(const float* vx, const float* vy, const float* vz,
+ const QuaternionArrays& q, float* rx, float* ry, float* rz, unsigned n);
+
+// r = normalized blend of a and b by fraction t along the shorter arc
+void nlerp(const QuaternionArrays& a, const QuaternionArrays& b,
+ const float* t, const QuaternionArrays& r, unsigned n);
+
+// r = interpolation of a and b by fraction t along the shorter arc
+void slerp(const QuaternionArrays& a, const QuaternionArrays& b,
+ const float* t, const QuaternionArrays& r, unsigned n);
+
+// r = squad of a and b by fraction t with control quaternions sa and sb
+void squad(const QuaternionArrays& a, const QuaternionArrays& b,
+ const QuaternionArrays& sa, const QuaternionArrays& sb, const float* t,
+ const QuaternionArrays& r, unsigned n);
+
+#endif
@@ -0,0 +1,154 @@
+/* RenderQueue Implementation - Modelling Layer
+ *
+ * RenderQueue.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <cstring>          // for memcmp, memset
+#include "RenderQueue.h"    // for the RenderQueue class definition
+#include "ModellingLayer.h" // for Category
+
+#define TEXTURE_BITS  16
+#define MATERIAL_BITS 20
+#define GRAPHIC_BITS  12
+#define DEPTH_BITS    24
+#define DEPTH_MAX     ((1u << DEPTH_BITS) - 1)
+
+//-------------------------------- RenderQueue --------------------------------
+//
+// reset clears the queue and forgets the textures and materials identified
+// in the previous frame
+//
+void RenderQueue::reset() {
+
+    item.clear();
+    texture.clear();
+    filter.clear();
+    material.clear();
+    graphic.clear();
+    lastMaterial = 0;
+}
+
+// textureId returns the identifier of texture t sampled with flags - 0 for
+// no texture - identifiers start at 1
+//
+unsigned RenderQueue::textureId(const void* t, unsigned flags) {
+
+    if (!t) return 0;
+
+    unsigned i;
+    for (i = 0; i < texture.size(); i++)
+        if (texture[i] == t && filter[i] == flags)
+            return i + 1;
+    texture.push_back(t);
+    filter.push_back(flags);
+    return i + 1;
+}
+
+// materialId returns the identifier of the material with the reflectivity
+// at address r - 0 for no reflectivity - materials with identical values
+// share an identifier
+//
+unsigned RenderQueue::materialId(const void* r) {
+
+    if (!r) return 0;
+
+    // neighbouring objects often share a material
+    if (lastMaterial && !memcmp(&material[lastMaterial - 1], r,
+     sizeof(Reflectivity)))
+        return lastMaterial;
+
+    unsigned i;
+    for (i = 0; i < material.size(); i++)
+        if (!memcmp(&material[i], r, sizeof(Reflectivity)))
+            return lastMaterial = i + 1;
+    material.push_back(*(const Reflectivity*)r);
+    return lastMaterial = i + 1;
+}
+
+// graphicId returns the identifier of graphic g - 0 for no graphic -
+// identifiers start at 1
+//
+unsigned RenderQueue::graphicId(const void* g) {
+
+    if (!g) return 0;
+
+    unsigned i;
+    for (i = 0; i < graphic.size(); i++)
+        if (graphic[i] == g)
+            return i + 1;
+    graphic.push_back(g);
+    return i + 1;
+}
+
+// add adds a draw item for the object in slot s to the queue - depth is the
+// distance from the camera normalized to [0,1] - identifiers that exceed
+// their field in the key only coarsen the sort order
+//
+void RenderQueue::add(unsigned s, Category c, unsigned tex, unsigned mat,
+ unsigned gra, bool translucent, float depth) {
+
+    if (depth < 0) depth = 0;
+    else if (depth > 1) depth = 1;
+    SortKey d = (SortKey)(depth * DEPTH_MAX);
+    SortKey t = tex & ((1u << TEXTURE_BITS) - 1);
+    SortKey m = mat & ((1u << MATERIAL_BITS) - 1);
+    SortKey g = gra & ((1u << GRAPHIC_BITS) - 1);
+
+    DrawItem i;
+    i.key  = (SortKey)(c & 7) << 61;
+    if (translucent)
+        // back to front
+        i.key |= (SortKey)1 << 60 | (DEPTH_MAX - d) << 36 |
+         t << MATERIAL_BITS | m;
+    else
+        // coarse depth within each group of identical graphics
+        i.key |= t << 44 | m << 24 | g << 12 | d >> 12;
+    i.slot     = s;
+    i.texture  = tex;
+    i.material = mat;
+    i.graphic  = gra;
+    item.push_back(i);
+}
+
+// sort orders the items by ascending key using a least significant digit
+// radix sort on 8-bit digits - digits that are the same in every key are
+// skipped
+//
+void RenderQueue::sort() {
+
+    unsigned n = item.size();
+    if (n < 2) return;
+    scratch.resize(n);
+
+    DrawItem* src = &item[0];
+    DrawItem* dst = &scratch[0];
+    unsigned  count[256];
+
+    for (int shift = 0; shift < 64; shift += 8) {
+        memset(count, 0, sizeof count);
+        for (unsigned i = 0; i < n; i++)
+            count[(src[i].key >> shift) & 0xFF]++;
+        if (count[(src[0].key >> shift) & 0xFF] == n)
+            continue;
+        unsigned offset = 0;
+        for (int b = 0; b < 256; b++) {
+            unsigned c = count[b];
+            count[b]   = offset;
+            offset    += c;
+        }
+        for (unsigned i = 0; i < n; i++)
+            dst[count[(src[i].key >> shift) & 0xFF]++] = src[i];
+        DrawItem* tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    // an odd number of passes leaves the result in the sort buffer
+    if (src != &item[0])
+        item.swap(scratch);
+}
@@ -0,0 +1,67 @@
+#ifndef _RENDER_QUEUE_H_
+#define _RENDER_QUEUE_H_
+
+/* RenderQueue Definition - Modelling Layer
+ *
+ * RenderQueue.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <vector>
+#include "MathDeclarations.h" // for Reflectivity
+
+//-------------------------------- RenderQueue --------------------------------
+//
+// The RenderQueue class collects the draw items for a frame and orders them
+// by a 64-bit sort key
+//
+// key layout - most significant bits first
+//
+//    opaque      | category:3 | 0 | texture:16 | material:20 | graphic:12 |
+//                  depth:12 |
+//    translucent | category:3 | 1 | depth:24 | texture:16 | material:20 |
+//
+// opaque items are grouped by texture, material and graphic and then drawn
+// front to back; translucent items are drawn back to front
+//
+enum Category;
+
+typedef unsigned long long SortKey;
+
+struct DrawItem {
+    SortKey  key;      // sort key
+    unsigned slot;     // identifies the object drawn
+    unsigned texture;  // texture identifier
+    unsigned material; // material identifier
+    unsigned graphic;  // graphic identifier
+};
+
+class RenderQueue {
+
+    std::vector<DrawItem>     item;     // items to be drawn
+    std::vector<DrawItem>     scratch;  // sort buffer
+    std::vector<const void*>  texture;  // distinct textures this frame
+    std::vector<unsigned>     filter;   // sampling flags for each texture
+    std::vector<Reflectivity> material; // distinct materials this frame
+    std::vector<const void*>  graphic;  // distinct graphics this frame
+    unsigned                  lastMaterial; // most recently found material
+
+  public:
+    RenderQueue() : lastMaterial(0) {}
+    void     reset();
+    void     clear()                          { item.clear(); }
+    unsigned textureId(const void* t, unsigned flags);
+    unsigned materialId(const void* r);
+    unsigned graphicId(const void* g);
+    void     add(unsigned slot, Category c, unsigned texture,
+     unsigned material, unsigned graphic, bool translucent, float depth);
+    void     sort();
+    unsigned size() const                     { return item.size(); }
+    const DrawItem& operator[](unsigned i) const { return item[i]; }
+};
+
+#endif
@@ -0,0 +1,251 @@
+/* Skin Implementation - Modelling Layer
+ *
+ * Skin.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "Skin.h"            // for the Skin class definition
+#include "Graphic.h"         // for the Vertex class definition
+#include "Workers.h"         // for the Workers class definition
+#include "iCoordinator.h"    // for the Coordinator Interface
+#include "iAPIGraphic.h"     // for the APIGraphic Interface
+#include "iFrame.h"          // for the Frame Interface
+#include "MathDefinitions.h" // for inverse and quaternion
+#include "ModellingLayer.h"  // for SKIN_SLICE
+#include "Common_Symbols.h"  // for TRIANGLE_LIST
+
+//-------------------------------- Skin ---------------------------------------
+//
+// The Skin object poses a mesh with the joints of a skeleton
+//
+// CreateSkin creates a Skin object from the nv vertices in v - if index is
+// not nullptr, the ni indices in index describe a triangle list of the
+// vertices, otherwise the vertices are a triangle list themselves
+//
+iSkin* CreateSkin(const SkinVertex* v, unsigned nv, const unsigned* index,
+ unsigned ni) {
+
+    return new Skin(v, nv, index, ni);
+}
+
+// skinSlice is the task that skins vertices first to last of skin s into
+// out
+//
+static void skinSlice(void* s, unsigned first, unsigned last, void* out) {
+
+    ((const Skin*)s)->skin(first, last, (float*)out);
+}
+
+// constructor copies the vertices and the triangles that refer to them,
+// creates the Translation and attaches the skin to the shared workers -
+// the joints that the vertices refer to stay in the bind pose until the
+// skeleton is bound
+//
+Skin::Skin(const SkinVertex* v, unsigned nv, const unsigned* i,
+ unsigned ni) : nVertices(nv), nIndices(0), nJoints(1), root(nullptr),
+ mode(SKIN_LINEAR) {
+
+    coordinator->add((iGraphic*)this);
+
+    shared          = new Shared;
+    shared->refs    = 1;
+    shared->vertex  = new SkinVertex[nVertices ? nVertices : 1];
+    shared->indices = nullptr;
+    SkinVertex* vertex = shared->vertex;
+    for (unsigned j = 0; j < nVertices; j++) {
+        vertex[j] = v[j];
+        for (unsigned k = 0; k < SKIN_INFLUENCES; k++)
+            if ((!k || v[j].weight[k]) && v[j].joint[k] >= nJoints)
+                nJoints = v[j].joint[k] + 1;
+    }
+
+    if (i) {
+        // keep only the triangles whose vertices exist
+        unsigned* indices = shared->indices = new unsigned[ni ? ni : 1];
+        for (unsigned j = 0; j + 2 < ni; j += 3)
+            if (i[j] < nv && i[j + 1] < nv && i[j + 2] < nv) {
+                indices[nIndices++] = i[j];
+                indices[nIndices++] = i[j + 1];
+                indices[nIndices++] = i[j + 2];
+            }
+    }
+    else
+        nVertices = nVertices / 3 * 3;
+
+    api     = CreateAPIDynamicList(TRIANGLE_LIST, Vertex::vertexSize(),
+     Vertex::vertexFormat(), this);
+    workers = AttachWorkers();
+}
+
+// copy constructor shares the mesh of src and copies its binding - the
+// copy has its own Translation and attaches to the shared workers
+//
+Skin::Skin(const Skin& src) : nVertices(src.nVertices),
+ nIndices(src.nIndices), shared(src.shared), nJoints(src.nJoints),
+ root(src.root), joint(src.joint), bindPose(src.bindPose),
+ mode(src.mode) {
+
+    coordinator->add((iGraphic*)this);
+
+    shared->refs++;
+    api     = CreateAPIDynamicList(TRIANGLE_LIST, Vertex::vertexSize(),
+     Vertex::vertexFormat(), this);
+    workers = AttachWorkers();
+}
+
+// bind binds the n joints in joint to the skin - joint k moves the
+// vertices that refer to joint number k - and records their current pose
+// relative to root as the bind pose - a root of nullptr poses the skin in
+// world space
+//
+void Skin::bind(iFrame* r, iFrame* const* j, unsigned n) {
+
+    root = r;
+    joint.assign(j, j + n);
+    bindPose.resize(n);
+    Matrix w = root ? inverse(root->world()) : Matrix(1);
+    for (unsigned k = 0; k < n; k++)
+        bindPose[k] = joint[k] ? inverse(joint[k]->world() * w) : Matrix(1);
+}
+
+// pose fills the palette with the transformation of each joint from the
+// bind pose to its current pose relative to the root - as matrix rows for
+// the linear blend and as dual quaternions otherwise - joints that are not
+// bound stay in the bind pose
+//
+void Skin::pose() const {
+
+    unsigned stride = mode == SKIN_LINEAR ? 16 : 8;
+    palette.resize(stride * nJoints);
+    Matrix w = root ? inverse(root->world()) : Matrix(1);
+    for (unsigned k = 0; k < nJoints; k++) {
+        Matrix m = k < joint.size() && joint[k] ?
+         bindPose[k] * joint[k]->world() * w : Matrix(1);
+        float* p = &palette[stride * k];
+        if (mode == SKIN_LINEAR) {
+            p[0]  = m.m11; p[1]  = m.m12; p[2]  = m.m13; p[3]  = 0;
+            p[4]  = m.m21; p[5]  = m.m22; p[6]  = m.m23; p[7]  = 0;
+            p[8]  = m.m31; p[9]  = m.m32; p[10] = m.m33; p[11] = 0;
+            p[12] = m.m41; p[13] = m.m42; p[14] = m.m43; p[15] = 0;
+        }
+        else {
+            Quaternion q = quaternion(m);
+            dualQuaternion(q.x, q.y, q.z, q.w, m.m41, m.m42, m.m43, p);
+        }
+    }
+}
+
+// skin skins vertices first to last into the vertex array at out - runs on
+// the workers
+//
+void Skin::skin(unsigned first, unsigned last, float* out) const {
+
+    const SkinVertex* v = shared->vertex + first;
+
+    if (mode == SKIN_LINEAR)
+        skinLinear(v, last - first, &palette[0], out + 8 * first);
+    else
+        skinDualQuaternion(v, last - first, &palette[0], out + 8 * first);
+}
+
+// skin poses the joints and skins the first n vertices into out in slices
+// of SKIN_SLICE on the workers
+//
+void Skin::skin(float* out, unsigned n) const {
+
+    std::vector<WorkerTask> task;
+    pose();
+    slice(task, skinSlice, (void*)this, n, SKIN_SLICE, out);
+    workers->run(task);
+}
+
+// count returns the number of vertices that the skin streams - none for an
+// indexed skin without any complete triangles
+//
+unsigned Skin::count() const {
+
+    return shared->indices && !nIndices ? 0 : nVertices;
+}
+
+// upload skins the n vertices of the current pose into the locked vertex
+// buffer
+//
+void Skin::upload(void* pv, unsigned n) const {
+
+    skin((float*)pv, n < nVertices ? n : nVertices);
+}
+
+// prepare creates the vertex stream and the index buffer ahead of the first
+// draw
+//
+bool Skin::prepare() {
+
+    return api->prepare(count());
+}
+
+// position returns the position of vertex i in the bind pose
+//
+Vector Skin::position(int i) const {
+
+    const SkinVertex& v = shared->vertex[i];
+
+    return Vector(v.x, v.y, v.z);
+}
+
+// bounds reports no finite bounds - the vertices follow the joints, so an
+// object that draws the skin is never culled
+//
+float Skin::bounds(Vector& min, Vector& max, Vector& c) const {
+
+    min = max = c = Vector();
+
+    return 0;
+}
+
+// render draws the skin in its current pose
+//
+void Skin::render() {
+
+    api->draw(count());
+}
+
+// render draws the skin in its current pose once for each of the n world
+// transformations in w
+//
+void Skin::render(const Matrix* w, unsigned n) {
+
+    api->draw(count(), w, n);
+}
+
+// suspend suspends the Translation
+//
+void Skin::suspend() {
+
+    api->suspend();
+}
+
+// release releases the Translation
+//
+void Skin::release() {
+
+    api->release();
+}
+
+// destructor deletes the Translation, releases the skin's share of the
+// mesh and detaches the skin from the shared workers
+//
+Skin::~Skin() {
+
+    api->Delete();
+    if (!--shared->refs) {
+        delete [] shared->vertex;
+        if (shared->indices) delete [] shared->indices;
+        delete shared;
+    }
+    DetachWorkers();
+    coordinator->remove((iGraphic*)this);
+}
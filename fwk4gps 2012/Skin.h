@@ -0,0 +1,91 @@
+#ifndef _SKIN_H_
+#define _SKIN_H_
+
+/* Skin Definition - Modelling Layer
+ *
+ * Skin.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <vector>
+#include "iSkin.h"            // for the Skin Interface
+#include "MathDeclarations.h" // for Matrix
+
+//-------------------------------- Skin ---------------------------------------
+//
+// The Skin class draws a mesh whose vertices follow the joints of a
+// skeleton - each joint is a Frame and the skin is posed in the frame of
+// the skeleton's root, which is normally the object that draws the skin -
+// the joints are bound in the pose that matches the vertices
+//
+// each frame the posed vertices are skinned in slices on the shared
+// workers straight into the Translation's dynamic vertex stream - the
+// Translation draws an indexed skin through a static index buffer
+//
+// a skin and its clones share the bind-pose vertices and triangles, which
+// no skin changes - each clone has its own palette and Translation, and
+// starts bound to the skeleton of its source
+//
+class iAPIGraphic;
+class Workers;
+
+class Skin : public iSkin {
+
+    struct Shared {
+        unsigned         refs;      // number of skins sharing the mesh
+        SkinVertex*      vertex;    // vertices in the bind pose
+        unsigned*        indices;   // triangle list of vertex numbers
+    };
+
+    unsigned             nVertices; // number of vertices in the bind pose
+    unsigned             nIndices;  // number of indices - 0 if unindexed
+    Shared*              shared;    // points to the shared mesh
+    unsigned             nJoints;   // joints referred to by the vertices
+    iFrame*              root;      // frame that the skin is posed in
+    std::vector<iFrame*> joint;     // joints of the skeleton
+    std::vector<Matrix>  bindPose;  // inverse of each joint at binding
+    mutable std::vector<float> palette; // joint transformations
+    Skinning             mode;      // linear or dual quaternion
+    iAPIGraphic*         api;       // streams the posed vertices
+    Workers*             workers;   // shared worker threads
+
+    Skin(const Skin& src);
+    Skin& operator=(const Skin&);
+    virtual ~Skin();
+    unsigned count() const;
+    void     pose() const;
+    void     skin(float* out, unsigned n) const;
+
+  public:
+    Skin(const SkinVertex* v, unsigned nv, const unsigned* i, unsigned ni);
+    void*    clone() const                    { return new Skin(*this); }
+    void     bind(iFrame* root, iFrame* const* joint, unsigned n);
+    void     setSkinning(Skinning s)          { mode = s; }
+    Skinning skinning() const                 { return mode; }
+    unsigned noJoints() const                 { return joint.size(); }
+    void     skin(unsigned first, unsigned last, float* out) const;
+    void     upload(void* pv, unsigned n) const;
+    bool     prepare();
+    Vector   position(int i) const;
+    float    bounds(Vector& min, Vector& max, Vector& c) const;
+    unsigned noIndices() const                { return nIndices; }
+    unsigned index(unsigned i) const          { return shared->indices[i]; }
+    void     render();
+    void     render(const Matrix* w, unsigned n);
+    unsigned noPrimitives() const {
+        return (shared->indices ? nIndices : nVertices) / 3;
+    }
+    unsigned batchKey() const                 { return 0; }
+    iGraphic* merge(iGraphic* const*, const Matrix*, unsigned) const {
+        return nullptr;
+    }
+    iGraphic* simplify(float) const           { return nullptr; }
+    void     suspend();
+    void     release();
+};
+
+#endif
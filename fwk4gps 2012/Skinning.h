@@ -0,0 +1,196 @@
+#ifndef _SKINNING_H_
+#define _SKINNING_H_
+
+/* Skinning Functions - Modelling Layer
+ *
+ * Skinning.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <math.h> // for sqrtf
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE__)
+#define SKIN_SSE
+#include <xmmintrin.h> // for the SSE intrinsics
+#endif
+
+//-------------------------------- Skinning -----------------------------------
+//
+// A SkinVertex holds a textured vertex in the bind pose of a skeleton along
+// with up to four joints that move it - the weights of a vertex sum to 1
+// and its unused joints have weight 0
+//
+// skinLinear and skinDualQuaternion pose n skin vertices with the joint
+// transformations in a palette and write them in the Vertex layout - x y z
+// nx ny nz tu tv - to out
+//
+#define SKIN_INFLUENCES 4
+
+struct SkinVertex {
+    float         x, y, z;                 // position in the bind pose
+    float         nx, ny, nz;              // normal in the bind pose
+    float         tu, tv;                  // texture coordinates
+    unsigned char joint[SKIN_INFLUENCES];  // joints that move the vertex
+    float         weight[SKIN_INFLUENCES]; // weight of each joint
+};
+
+// skinLinear blends the joint matrices of each vertex by weight and
+// transforms the vertex by the blend - the palette holds 16 floats for each
+// joint, the rows of its matrix without the fourth column followed by 0 -
+// normals are renormalized, which is exact for rigid and uniformly scaled
+// joints
+//
+inline void skinLinear(const SkinVertex* v, unsigned n, const float* palette,
+ float* out) {
+
+    for (unsigned i = 0; i < n; i++, v++, out += 8) {
+        float p[4], q[4];
+        #ifdef SKIN_SSE
+        const float* m = palette + 16 * v->joint[0];
+        __m128 w  = _mm_set1_ps(v->weight[0]);
+        __m128 r0 = _mm_mul_ps(w, _mm_loadu_ps(m));
+        __m128 r1 = _mm_mul_ps(w, _mm_loadu_ps(m + 4));
+        __m128 r2 = _mm_mul_ps(w, _mm_loadu_ps(m + 8));
+        __m128 r3 = _mm_mul_ps(w, _mm_loadu_ps(m + 12));
+        for (unsigned k = 1; k < SKIN_INFLUENCES; k++)
+            if (v->weight[k]) {
+                m  = palette + 16 * v->joint[k];
+                w  = _mm_set1_ps(v->weight[k]);
+                r0 = _mm_add_ps(r0, _mm_mul_ps(w, _mm_loadu_ps(m)));
+                r1 = _mm_add_ps(r1, _mm_mul_ps(w, _mm_loadu_ps(m + 4)));
+                r2 = _mm_add_ps(r2, _mm_mul_ps(w, _mm_loadu_ps(m + 8)));
+                r3 = _mm_add_ps(r3, _mm_mul_ps(w, _mm_loadu_ps(m + 12)));
+            }
+        __m128 a = _mm_add_ps(_mm_add_ps(
+         _mm_mul_ps(_mm_set1_ps(v->x), r0),
+         _mm_mul_ps(_mm_set1_ps(v->y), r1)),
+         _mm_mul_ps(_mm_set1_ps(v->z), r2));
+        __m128 b = _mm_add_ps(_mm_add_ps(
+         _mm_mul_ps(_mm_set1_ps(v->nx), r0),
+         _mm_mul_ps(_mm_set1_ps(v->ny), r1)),
+         _mm_mul_ps(_mm_set1_ps(v->nz), r2));
+        _mm_storeu_ps(p, _mm_add_ps(a, r3));
+        _mm_storeu_ps(q, b);
+        #else
+        float r[16] = {0};
+        for (unsigned k = 0; k < SKIN_INFLUENCES; k++)
+            if (v->weight[k]) {
+                const float* m = palette + 16 * v->joint[k];
+                for (unsigned c = 0; c < 16; c++)
+                    r[c] += v->weight[k] * m[c];
+            }
+        for (unsigned c = 0; c < 3; c++) {
+            p[c] = v->x * r[c] + v->y * r[4 + c] + v->z * r[8 + c] + r[12 + c];
+            q[c] = v->nx * r[c] + v->ny * r[4 + c] + v->nz * r[8 + c];
+        }
+        #endif
+        float l = sqrtf(q[0] * q[0] + q[1] * q[1] + q[2] * q[2]);
+        float s = l ? 1 / l : 0;
+        out[0] = p[0];
+        out[1] = p[1];
+        out[2] = p[2];
+        out[3] = q[0] * s;
+        out[4] = q[1] * s;
+        out[5] = q[2] * s;
+        out[6] = v->tu;
+        out[7] = v->tv;
+    }
+}
+
+// skinDualQuaternion blends the unit dual quaternions of the joints of
+// each vertex by weight, each on the same hemisphere as the first, and
+// transforms the vertex by the normalized blend - the palette holds 8
+// floats for each joint, the rotation x y z w followed by the dual part -
+// the blend does not collapse the volume around twisting joints as the
+// linear blend does, but the joints must be rigid
+//
+inline void skinDualQuaternion(const SkinVertex* v, unsigned n,
+ const float* palette, float* out) {
+
+    for (unsigned i = 0; i < n; i++, v++, out += 8) {
+        const float* d0 = palette + 8 * v->joint[0];
+        float b[8];
+        #ifdef SKIN_SSE
+        __m128 sign = _mm_set1_ps(-0.0f);
+        __m128 w    = _mm_set1_ps(v->weight[0]);
+        __m128 br   = _mm_mul_ps(w, _mm_loadu_ps(d0));
+        __m128 be   = _mm_mul_ps(w, _mm_loadu_ps(d0 + 4));
+        for (unsigned k = 1; k < SKIN_INFLUENCES; k++)
+            if (v->weight[k]) {
+                const float* d = palette + 8 * v->joint[k];
+                float c = d[0] * d0[0] + d[1] * d0[1] + d[2] * d0[2] +
+                 d[3] * d0[3];
+                // the sign of c moves the joint onto the first's hemisphere
+                w  = _mm_xor_ps(_mm_set1_ps(v->weight[k]),
+                 _mm_and_ps(_mm_set1_ps(c), sign));
+                br = _mm_add_ps(br, _mm_mul_ps(w, _mm_loadu_ps(d)));
+                be = _mm_add_ps(be, _mm_mul_ps(w, _mm_loadu_ps(d + 4)));
+            }
+        _mm_storeu_ps(b, br);
+        _mm_storeu_ps(b + 4, be);
+        #else
+        for (unsigned c = 0; c < 8; c++)
+            b[c] = v->weight[0] * d0[c];
+        for (unsigned k = 1; k < SKIN_INFLUENCES; k++)
+            if (v->weight[k]) {
+                const float* d = palette + 8 * v->joint[k];
+                float c = d[0] * d0[0] + d[1] * d0[1] + d[2] * d0[2] +
+                 d[3] * d0[3];
+                float wk = c < 0 ? -v->weight[k] : v->weight[k];
+                for (unsigned j = 0; j < 8; j++)
+                    b[j] += wk * d[j];
+            }
+        #endif
+        float l = sqrtf(b[0] * b[0] + b[1] * b[1] + b[2] * b[2] +
+         b[3] * b[3]);
+        float s = l ? 1 / l : 0;
+        float x = b[0] * s, y = b[1] * s, z = b[2] * s, rw = b[3] * s;
+        float ex = b[4] * s, ey = b[5] * s, ez = b[6] * s, ew = b[7] * s;
+
+        // translation - twice the vector part of the dual times the
+        // conjugate of the rotation
+        float tx = 2 * (rw * ex - ew * x + y * ez - z * ey);
+        float ty = 2 * (rw * ey - ew * y + z * ex - x * ez);
+        float tz = 2 * (rw * ez - ew * z + x * ey - y * ex);
+
+        // rotation - p + w t + r x t where t = 2 r x p
+        float ax = 2 * (y * v->z - z * v->y);
+        float ay = 2 * (z * v->x - x * v->z);
+        float az = 2 * (x * v->y - y * v->x);
+        out[0] = v->x + rw * ax + y * az - z * ay + tx;
+        out[1] = v->y + rw * ay + z * ax - x * az + ty;
+        out[2] = v->z + rw * az + x * ay - y * ax + tz;
+        ax = 2 * (y * v->nz - z * v->ny);
+        ay = 2 * (z * v->nx - x * v->nz);
+        az = 2 * (x * v->ny - y * v->nx);
+        out[3] = v->nx + rw * ax + y * az - z * ay;
+        out[4] = v->ny + rw * ay + z * ax - x * az;
+        out[5] = v->nz + rw * az + x * ay - y * ax;
+        out[6] = v->tu;
+        out[7] = v->tv;
+    }
+}
+
+// dualQuaternion stores in d the unit dual quaternion of the rigid
+// transformation that rotates by unit quaternion x y z w and then
+// translates by tx ty tz - the dual part is half the translation times
+// the rotation
+//
+inline void dualQuaternion(float x, float y, float z, float w, float tx,
+ float ty, float tz, float* d) {
+
+    d[0] = x;
+    d[1] = y;
+    d[2] = z;
+    d[3] = w;
+    d[4] = 0.5f * (w * tx + ty * z - tz * y);
+    d[5] = 0.5f * (w * ty + tz * x - tx * z);
+    d[6] = 0.5f * (w * tz + tx * y - ty * x);
+    d[7] = -0.5f * (tx * x + ty * y + tz * z);
+}
+
+#endif
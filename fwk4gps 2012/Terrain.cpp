@@ -0,0 +1,553 @@
+/* Terrain Implementation - Modelling Layer
+ *
+ * Terrain.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <vector>
+#include <cmath>               // for sqrtf
+#include "Terrain.h"           // for the Terrain class definition
+#include "iCoordinator.h"      // for the Coordinator Interface
+#include "iAssetLoader.h"      // for the AssetLoader Interface
+#include "iUtilities.h"        // for strlen, nameWithDir
+
+#include "IndexedVertexList.h" // for the IndexedVertexList template
+#include "Camera.h"            // for the current camera
+#include "MathDefinitions.h"   // for Vector and MODEL_Z_AXIS
+#include "ModellingLayer.h"    // for ASSET_DIRECTORY and TERRAIN_...
+#include "Common_Symbols.h"    // for TRIANGLE_LIST
+
+// samples along each side of a chunk's border block - one beyond each edge
+// for the normals
+#define TERRAIN_BORDER (TERRAIN_CHUNK + 3)
+
+//-------------------------------- Chunk Meshes -------------------------------
+//
+// chunkVertex returns vertex (i, j) of the chunk whose first corner is
+// sample (x0, z0) - s holds the border block of the chunk's heights - the
+// vertex is lowered by drop for a skirt
+//
+static Vertex chunkVertex(const float* s, unsigned n, unsigned x0,
+ unsigned z0, unsigned stride, float spacing, int i, int j, float drop) {
+
+    #define S(a, b) s[((b) + 1) * TERRAIN_BORDER + (a) + 1]
+    float half = (n - 1) * 0.5f, step = stride * spacing;
+    unsigned x = x0 + i * stride, z = z0 + j * stride;
+    Vector normal = ::normal(Vector(S(i - 1, j) - S(i + 1, j), 2 * step,
+     S(i, j - 1) - S(i, j + 1)));
+    Vertex v(Vector((x - half) * spacing, S(i, j) - drop,
+     (z - half) * spacing), normal, (float)x / (n - 1), (float)z / (n - 1));
+    #undef S
+
+    return v;
+}
+
+// buildChunk builds the vertices and indices of the chunk whose first
+// corner is sample (x0, z0) - a grid of TERRAIN_CHUNK by TERRAIN_CHUNK
+// quads followed by a skirt along each edge that hangs below the grid and
+// faces outward
+//
+static void buildChunk(const float* s, unsigned n, unsigned x0, unsigned z0,
+ unsigned stride, float spacing, std::vector<Vertex>& v,
+ std::vector<unsigned>& index) {
+
+    const unsigned c = TERRAIN_CHUNK, w = c + 1, g = w * w;
+    float drop = TERRAIN_SKIRT * stride * spacing;
+
+    v.resize(g + 4 * w);
+    index.clear();
+    index.reserve(6 * c * c + 24 * c);
+
+    // the grid - two triangles per quad split along the same diagonal as
+    // the height queries
+    for (unsigned j = 0; j <= c; j++)
+        for (unsigned i = 0; i <= c; i++)
+            v[j * w + i] = chunkVertex(s, n, x0, z0, stride, spacing, i, j, 0);
+    for (unsigned j = 0; j < c; j++)
+        for (unsigned i = 0; i < c; i++) {
+            unsigned a = j * w + i, b = a + 1, d = a + w + 1, e = a + w;
+            index.push_back(a);
+            index.push_back(e);
+            index.push_back(d);
+            index.push_back(a);
+            index.push_back(d);
+            index.push_back(b);
+        }
+
+    // the skirts - edge 0 at the first z, 1 at the last x, 2 at the last z
+    // and 3 at the first x - top[k] is the grid vertex above skirt vertex k
+    for (unsigned e = 0; e < 4; e++) {
+        unsigned top[TERRAIN_CHUNK + 1];
+        for (unsigned k = 0; k <= c; k++) {
+            unsigned i = e == 1 ? c : e == 3 ? 0 : k;
+            unsigned j = e == 0 ? 0 : e == 2 ? c : k;
+            top[k] = j * w + i;
+            v[g + e * w + k] = chunkVertex(s, n, x0, z0, stride, spacing, i,
+             j, drop);
+        }
+        for (unsigned k = 0; k < c; k++) {
+            // left and right as seen from outside the chunk
+            bool reversed = e >= 2;
+            unsigned l = reversed ? k + 1 : k, r = reversed ? k : k + 1;
+            index.push_back(g + e * w + l);
+            index.push_back(top[l]);
+            index.push_back(top[r]);
+            index.push_back(g + e * w + l);
+            index.push_back(top[r]);
+            index.push_back(g + e * w + r);
+        }
+    }
+}
+
+// ChunkJob builds the mesh of one chunk on a worker thread from a copy of
+// the chunk's heights and hands it to the Terrain at a frame boundary
+//
+class ChunkJob : public iAssetJob {
+
+    Terrain*                   owner;  // terrain that requested the mesh
+    unsigned                   node;   // chunk's node in the quadtree
+    IndexedVertexList<Vertex>* list;   // mesh being built - owned by the job
+    std::vector<float>         border; // border block of the chunk's heights
+    unsigned                   n;      // samples along each side of terrain
+    unsigned                   x, z;   // first corner of the chunk
+    unsigned                   stride; // samples between chunk vertices
+    float                      spacing; // distance between samples
+
+    ChunkJob(const ChunkJob&);
+    ChunkJob& operator=(const ChunkJob&);
+    virtual ~ChunkJob() { if (list) list->Delete(); }
+
+  public:
+    ChunkJob(Terrain* o, unsigned i, IndexedVertexList<Vertex>* l,
+     std::vector<float>& b, unsigned nn, unsigned xx, unsigned zz,
+     unsigned st, float sp) : owner(o), node(i), list(l), n(nn), x(xx),
+     z(zz), stride(st), spacing(sp) { border.swap(b); }
+    bool load() {
+        std::vector<Vertex>   v;
+        std::vector<unsigned> i;
+        buildChunk(&border[0], n, x, z, stride, spacing, v, i);
+        return list->load(&v[0], v.size(), &i[0], i.size(),
+         sizeof(unsigned));
+    }
+    void complete(bool loaded) {
+        owner->loaded(node, loaded ? list : nullptr);
+        if (loaded) list = nullptr;
+    }
+    void Delete() const { delete this; }
+};
+
+//-------------------------------- Terrain ------------------------------------
+//
+// CreateTerrain reads a heightmap of n by n little-endian 16-bit samples
+// from file - a raw file of 2 * n * n bytes - and creates a terrain with
+// the specified spacing between samples - a sample of 65535 stands scale
+// above a sample of 0 - returns nullptr if the file cannot be read or n is
+// not TERRAIN_CHUNK * 2^k + 1
+//
+iTerrain* CreateTerrain(const wchar_t* file, float spacing, float scale) {
+
+    if (!file) return nullptr;
+
+	// construct filename with path
+	int len = strlen(file) + strlen(ASSET_DIRECTORY) + 1;
+	wchar_t* absFile = new wchar_t[len + 1];
+	nameWithDir(absFile, ASSET_DIRECTORY, file, len);
+
+    unsigned size;
+    unsigned char* data = readAsset(absFile, size);
+    delete [] absFile;
+    if (!data) return nullptr;
+
+    unsigned n = 1;
+    while ((n + 1) * (n + 1) * 2 <= size)
+        n++;
+    iTerrain* terrain = nullptr;
+    if (n * n * 2 == size) {
+        std::vector<float> h(n * n);
+        for (unsigned i = 0; i < n * n; i++)
+            h[i] = (data[2 * i] | data[2 * i + 1] << 8) * scale / 65535;
+        terrain = CreateTerrain(&h[0], n, spacing);
+    }
+    delete [] data;
+
+    return terrain;
+}
+
+// CreateTerrain creates a terrain from the n by n heights in h - row by
+// row in z - with the specified spacing between samples - returns nullptr
+// if n is not TERRAIN_CHUNK * 2^k + 1
+//
+iTerrain* CreateTerrain(const float* h, unsigned n, float spacing) {
+
+    unsigned chunks = n > 1 ? (n - 1) / TERRAIN_CHUNK : 0;
+
+    if (!h || !chunks || (n - 1) % TERRAIN_CHUNK || (chunks & (chunks - 1)) ||
+     spacing <= 0)
+        return nullptr;
+
+    return new Terrain(h, n, spacing);
+}
+
+// constructor copies the heights, builds the quadtree and the root chunk's
+// mesh and adds the terrain to the coordinator
+//
+Terrain::Terrain(const float* h, unsigned nn, float sp) : n(nn),
+ spacing(sp), frame(0), requested(0), resident(0) {
+
+    coordinator->add((iGraphic*)this);
+
+    sample = new float[n * n];
+    for (unsigned i = 0; i < n * n; i++)
+        sample[i] = h[i];
+    Node root = {0, 0, (n - 1) / TERRAIN_CHUNK, -1, 0, 0, nullptr, 0, 0};
+    node.push_back(root);
+    build(0);
+
+    std::vector<float>    s(TERRAIN_BORDER * TERRAIN_BORDER);
+    std::vector<Vertex>   v;
+    std::vector<unsigned> i;
+    IndexedVertexList<Vertex>* mesh =
+     (IndexedVertexList<Vertex>*)create(node[0]);
+    border(node[0], &s[0]);
+    buildChunk(&s[0], n, 0, 0, node[0].stride, spacing, v, i);
+    mesh->load(&v[0], v.size(), &i[0], i.size(), sizeof(unsigned));
+    node[0].mesh = mesh;
+    resident = 1;
+}
+
+// build adds the nodes of the four children of node i below the finest
+// level and the nodes of their subtrees - the four children of a node are
+// stored together - and records the range of heights within the chunk
+//
+void Terrain::build(unsigned i) {
+
+    unsigned x = node[i].x, z = node[i].z, stride = node[i].stride;
+
+    if (stride > 1) {
+        unsigned half = stride / 2, w = TERRAIN_CHUNK * half;
+        unsigned first = node.size();
+        node[i].child = first;
+        for (unsigned k = 0; k < 4; k++) {
+            Node c = {x + (k & 1) * w, z + (k >> 1) * w, half, -1, 0, 0,
+             nullptr, 0, 0};
+            node.push_back(c);
+        }
+        for (unsigned k = 0; k < 4; k++)
+            build(first + k);
+        node[i].minY = node[first].minY;
+        node[i].maxY = node[first].maxY;
+        for (unsigned k = 1; k < 4; k++) {
+            if (node[first + k].minY < node[i].minY)
+                node[i].minY = node[first + k].minY;
+            if (node[first + k].maxY > node[i].maxY)
+                node[i].maxY = node[first + k].maxY;
+        }
+    }
+    else {
+        float lo = at(x, z), hi = lo;
+        for (unsigned j = 0; j <= TERRAIN_CHUNK; j++)
+            for (unsigned k = 0; k <= TERRAIN_CHUNK; k++) {
+                float y = at(x + k, z + j);
+                if (y < lo) lo = y;
+                if (y > hi) hi = y;
+            }
+        node[i].minY = lo;
+        node[i].maxY = hi;
+    }
+}
+
+// at returns the height of sample (x, z), clamped to the heightmap
+//
+float Terrain::at(int x, int z) const {
+
+    int last = n - 1;
+    x = x < 0 ? 0 : x > last ? last : x;
+    z = z < 0 ? 0 : z > last ? last : z;
+
+    return sample[z * n + x];
+}
+
+// border copies the heights of chunk c and of one sample beyond each of
+// its edges into the TERRAIN_BORDER by TERRAIN_BORDER block s
+//
+void Terrain::border(const Node& c, float* s) const {
+
+    for (int j = -1; j <= TERRAIN_CHUNK + 1; j++)
+        for (int i = -1; i <= TERRAIN_CHUNK + 1; i++)
+            *s++ = at((int)c.x + i * (int)c.stride, (int)c.z + j * (int)c.stride);
+}
+
+// create creates an empty mesh for chunk c and withdraws it from the
+// coordinator
+//
+iGraphic* Terrain::create(const Node& c) const {
+
+    iGraphic* mesh = CreateIndexedVertexList<Vertex>(TRIANGLE_LIST,
+     2 * TERRAIN_CHUNK * TERRAIN_CHUNK + 8 * TERRAIN_CHUNK);
+    coordinator->remove(mesh);
+
+    return mesh;
+}
+
+// request queues the build of the mesh for node i unless one is pending or
+// this frame's requests are exhausted - nearer chunks are built first
+//
+void Terrain::request(unsigned i, float distance) {
+
+    Node& c = node[i];
+    if (c.mesh || c.handle || requested >= TERRAIN_REQUESTS) return;
+
+    std::vector<float> s(TERRAIN_BORDER * TERRAIN_BORDER);
+    border(c, &s[0]);
+    c.handle = loader->request(new ChunkJob(this, i,
+     (IndexedVertexList<Vertex>*)create(c), s, n, c.x, c.z, c.stride, 
+     spacing), -(int)distance);
+    requested++;
+}
+
+// loaded hands the built mesh of node i to the terrain - mesh is nullptr if
+// the build failed
+//
+void Terrain::loaded(unsigned i, iGraphic* mesh) {
+
+    Node& c = node[i];
+    c.handle = 0;
+    if (mesh) {
+        if (c.mesh)
+            c.mesh->Delete();
+        else
+            resident++;
+        c.mesh = mesh;
+    }
+}
+
+// select adds to the draw list the chunks of node i's subtree at the level
+// of detail for a camera at eye - a node is drawn from its children if the
+// camera is within TERRAIN_LOD widths of it and all four children are
+// resident, otherwise it is drawn itself and its missing children are
+// requested
+//
+void Terrain::select(unsigned i, const Vector& eye) {
+
+    const Node& c = node[i];
+    float half = (n - 1) * 0.5f, w = TERRAIN_CHUNK * c.stride * spacing;
+    float x = (c.x - half) * spacing, z = (c.z - half) * spacing;
+
+    // distance from the eye to the chunk's bounding box
+    float dx = eye.x < x ? x - eye.x : eye.x > x + w ? eye.x - x - w : 0;
+    float dy = eye.y < c.minY ? c.minY - eye.y : eye.y > c.maxY ? 
+     eye.y - c.maxY : 0;
+    float dz = eye.z < z ? z - eye.z : eye.z > z + w ? eye.z - z - w : 0;
+    float d  = sqrtf(dx * dx + dy * dy + dz * dz);
+
+    node[i].used = frame;
+    if (c.child >= 0 && d < TERRAIN_LOD * w) {
+        bool ready = true;
+        for (int k = c.child; k < c.child + 4; k++) {
+            node[k].used = frame;
+            if (!node[k].mesh) {
+                request(k, d);
+                ready = false;
+            }
+        }
+        if (ready) {
+            for (int k = c.child; k < c.child + 4; k++)
+                select(k, eye);
+            return;
+        }
+    }
+    drawList.push_back(i);
+}
+
+// select selects the chunks to draw in this frame and evicts the meshes
+// that have not been needed for TERRAIN_EVICT frames
+//
+void Terrain::select() {
+
+    frame++;
+    requested = 0;
+    drawList.clear();
+
+    const iFrame* camera = *Camera::getCurrent();
+    if (camera) {
+        Vector eye = camera->position();
+        eye.z *= MODEL_Z_AXIS;
+        select(0, eye);
+    }
+    else
+        drawList.push_back(0);
+    evict();
+}
+
+// evict deletes the meshes and withdraws the pending builds of the chunks
+// that have not been needed for TERRAIN_EVICT frames - the root chunk
+// stays resident
+//
+void Terrain::evict() {
+
+    for (unsigned i = 1; i < node.size(); i++) {
+        Node& c = node[i];
+        if (frame - c.used > TERRAIN_EVICT) {
+            if (c.mesh) {
+                c.mesh->Delete();
+                c.mesh = nullptr;
+                resident--;
+            }
+            if (c.handle) {
+                loader->cancel(c.handle);
+                c.handle = 0;
+            }
+        }
+    }
+}
+
+// render draws the chunks selected for the current camera
+//
+void Terrain::render() {
+
+    select();
+    for (unsigned i = 0; i < drawList.size(); i++)
+        node[drawList[i]].mesh->render();
+}
+
+// render draws the chunks selected for the current camera once for each of
+// the no world transformations in w
+//
+void Terrain::render(const Matrix* w, unsigned no) {
+
+    select();
+    for (unsigned i = 0; i < drawList.size(); i++)
+        node[drawList[i]].mesh->render(w, no);
+}
+
+// contains reports whether point (x, z) lies over the heightmap
+//
+bool Terrain::contains(float x, float z) const {
+
+    float half = (n - 1) * 0.5f;
+    float fx = x / spacing + half, fz = z / spacing + half;
+
+    return fx >= 0 && fz >= 0 && fx <= n - 1 && fz <= n - 1;
+}
+
+// height returns the height of the finest mesh at point (x, z) - 0 if the
+// point does not lie over the heightmap
+//
+float Terrain::height(float x, float z) const {
+
+    if (!contains(x, z)) return 0;
+
+    float half = (n - 1) * 0.5f;
+    float fx = x / spacing + half, fz = z / spacing + half;
+    int   i  = fx < n - 1 ? (int)fx : n - 2, j = fz < n - 1 ? (int)fz : n - 2;
+    float u  = fx - i, v = fz - j;
+    float a  = at(i, j), b = at(i + 1, j), c = at(i, j + 1),
+          d  = at(i + 1, j + 1);
+
+    // the quad is split along its diagonal from a to d
+    return v >= u ? a + u * (d - c) + v * (c - a) : 
+     a + u * (b - a) + v * (d - b);
+}
+
+// normal returns the unit normal of the finest mesh at point (x, z) - the
+// y axis if the point does not lie over the heightmap
+//
+Vector Terrain::normal(float x, float z) const {
+
+    if (!contains(x, z)) return Vector(0, 1, 0);
+
+    float half = (n - 1) * 0.5f;
+    float fx = x / spacing + half, fz = z / spacing + half;
+    int   i  = fx < n - 1 ? (int)fx : n - 2, j = fz < n - 1 ? (int)fz : n - 2;
+    float u  = fx - i, v = fz - j;
+    float a  = at(i, j), b = at(i + 1, j), c = at(i, j + 1),
+          d  = at(i + 1, j + 1);
+
+    // slopes of the triangle that holds the point
+    float sx = v >= u ? d - c : b - a, sz = v >= u ? c - a : d - b;
+
+    return ::normal(Vector(-sx, spacing, -sz));
+}
+
+// upload, position, noIndices, index and noPrimitives describe the root
+// chunk - the chunk meshes upload themselves
+//
+void Terrain::upload(void* pv, unsigned no) const {
+
+    node[0].mesh->upload(pv, no);
+}
+
+Vector Terrain::position(int i) const {
+
+    return node[0].mesh->position(i);
+}
+
+// bounds covers the whole heightmap rather than the root chunk's mesh so
+// that the finer chunks drawn near the viewer lie within it
+//
+float Terrain::bounds(Vector& min, Vector& max, Vector& c) const {
+
+    float half = (n - 1) * 0.5f * spacing;
+    min = Vector(-half, node[0].minY, -half);
+    max = Vector(half, node[0].maxY, half);
+    c   = 0.5f * (min + max);
+
+    return 0.5f * (max - min).length();
+}
+
+unsigned Terrain::noIndices() const {
+
+    return node[0].mesh->noIndices();
+}
+
+unsigned Terrain::index(unsigned i) const {
+
+    return node[0].mesh->index(i);
+}
+
+unsigned Terrain::noPrimitives() const {
+
+    return node[0].mesh->noPrimitives();
+}
+
+// prepare creates the API resources of the root chunk
+//
+bool Terrain::prepare() {
+
+    return node[0].mesh->prepare();
+}
+
+// suspend suspends the resident chunk meshes
+//
+void Terrain::suspend() {
+
+    for (unsigned i = 0; i < node.size(); i++)
+        if (node[i].mesh) node[i].mesh->suspend();
+}
+
+// release releases the resident chunk meshes
+//
+void Terrain::release() {
+
+    for (unsigned i = 0; i < node.size(); i++)
+        if (node[i].mesh) node[i].mesh->release();
+}
+
+// destructor withdraws the pending builds, deletes the chunk meshes and
+// removes the terrain from the coordinator
+//
+Terrain::~Terrain() {
+
+    for (unsigned i = 0; i < node.size(); i++) {
+        if (node[i].handle && loader)
+            loader->cancel(node[i].handle);
+        if (node[i].mesh)
+            node[i].mesh->Delete();
+    }
+    delete [] sample;
+    coordinator->remove((iGraphic*)this);
+}
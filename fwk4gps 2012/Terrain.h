@@ -0,0 +1,96 @@
+#ifndef _TERRAIN_H_
+#define _TERRAIN_H_
+
+/* Terrain Definition - Modelling Layer
+ *
+ * Terrain.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <vector>
+#include "iTerrain.h" // for the Terrain Interface
+
+//-------------------------------- Terrain ------------------------------------
+//
+// The Terrain class draws a heightmap as a quadtree of square chunks - each
+// node of the tree is a chunk of TERRAIN_CHUNK by TERRAIN_CHUNK quads that
+// samples the heightmap at the spacing of its level - the nodes near the
+// camera are drawn from their finer children and those farther away from
+// their coarser ancestors - a skirt hung from the edges of each chunk hides
+// the cracks between neighbours at different levels
+//
+// the root chunk is always resident - the meshes of the other chunks are 
+// built on the asset workers as the camera approaches them and are deleted 
+// once they have not been needed for TERRAIN_EVICT frames - the Terrain
+// owns the meshes and withdraws them from the coordinator
+//
+// the terrain is centred on the origin of its local frame and is drawn by
+// an object that is not moved - the height and normal queries and the
+// level selection work in that frame
+//
+class iGraphic;
+
+class Terrain : public iTerrain {
+
+    struct Node {
+        unsigned  x, z;     // heightmap sample at the chunk's first corner
+        unsigned  stride;   // samples between adjacent chunk vertices
+        int       child;    // node number of the first of four children
+        float     minY;     // lowest height within the chunk
+        float     maxY;     // highest height within the chunk
+        iGraphic* mesh;     // indexed triangle list - nullptr if absent
+        unsigned  handle;   // asynchronous build request - 0 if none
+        unsigned  used;     // frame in which the chunk was last needed
+    };
+
+    unsigned               n;         // samples along each side
+    float                  spacing;   // distance between adjacent samples
+    float*                 sample;    // n * n heights - row by row in z
+    std::vector<Node>      node;      // quadtree - the root is node 0
+    std::vector<unsigned>  drawList;  // nodes drawn in this frame
+    unsigned               frame;     // frames selected so far
+    unsigned               requested; // requests made in this frame
+    unsigned               resident;  // number of resident chunk meshes
+
+    Terrain(const Terrain&);
+    Terrain& operator=(const Terrain&);
+    virtual ~Terrain();
+    void   build(unsigned i);
+    void   border(const Node& c, float* s) const;
+    iGraphic* create(const Node& c) const;
+    void   request(unsigned i, float distance);
+    void   select(unsigned i, const Vector& eye);
+    void   select();
+    void   evict();
+    float  at(int x, int z) const;
+
+  public:
+    Terrain(const float* h, unsigned n, float spacing);
+    void   loaded(unsigned i, iGraphic* mesh);
+    float  height(float x, float z) const;
+    Vector normal(float x, float z) const;
+    bool   contains(float x, float z) const;
+    unsigned noResident() const        { return resident; }
+    void   upload(void* pv, unsigned no) const;
+    bool   prepare();
+    Vector position(int i) const;
+    float  bounds(Vector& min, Vector& max, Vector& c) const;
+    unsigned noIndices() const;
+    unsigned index(unsigned i) const;
+    void   render();
+    void   render(const Matrix* w, unsigned no);
+    unsigned  noPrimitives() const;
+    unsigned  batchKey() const         { return 0; }
+    iGraphic* merge(iGraphic* const*, const Matrix*, unsigned) const {
+        return nullptr;
+    }
+    iGraphic* simplify(float) const    { return nullptr; }
+    void   suspend();
+    void   release();
+};
+
+#endif
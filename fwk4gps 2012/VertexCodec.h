@@ -0,0 +1,158 @@
+#ifndef _VERTEX_CODEC_H_
+#define _VERTEX_CODEC_H_
+
+/* VertexCodec Functions - Modelling Layer
+ *
+ * VertexCodec.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <cstring> // for memcpy
+
+//-------------------------------- VertexCodec --------------------------------
+//
+// A PackedVertex holds a textured vertex in half the space of a Vertex -
+// its position is quantized to 16 bits per component over the bounds of
+// its mesh, its normal is packed 10:10:10:2 and its texture coordinates
+// are half floats - packVertices encodes an array of Vertex data and
+// unpackVertices decodes it again for upload
+//
+// the fixed-function pipeline only reads float positions and normals, so
+// a packed mesh is stored packed and decoded into the Vertex format as it
+// is copied into the vertex buffer
+//
+struct PackedVertex {
+    unsigned short x, y, z; // position quantized over the mesh bounds
+    unsigned short tu, tv;  // texture coordinates as half floats
+    unsigned short unused;  // pads the vertex to 16 bytes
+    unsigned       normal;  // normal as signed 10:10:10 in the low 30 bits
+};
+
+// floatToHalf converts f to a half float, rounding to nearest - values too
+// large for a half float become infinities
+//
+inline unsigned short floatToHalf(float f) {
+
+    unsigned x;
+    memcpy(&x, &f, sizeof x);
+    unsigned sign = (x >> 16) & 0x8000;
+    int      e    = (int)((x >> 23) & 0xff) - 127 + 15;
+    unsigned m    = x & 0x7fffff;
+
+    if (e >= 31)
+        return (unsigned short)(sign | 0x7c00 |
+         ((x & 0x7fffffff) > 0x7f800000 ? 0x200 : 0));
+    if (e <= 0) {
+        if (e < -10) return (unsigned short)sign;
+        m |= 0x800000;
+        unsigned shift = 14 - e;
+        unsigned h = m >> shift;
+        if ((m >> (shift - 1)) & 1) h++;
+        return (unsigned short)(sign | h);
+    }
+    unsigned h = sign | e << 10 | m >> 13;
+    if (m & 0x1000) h++;
+
+    return (unsigned short)h;
+}
+
+// halfToFloat converts half float h to a float - the exponent and mantissa
+// bits moved into place and scaled by 2^112 give the value of every finite
+// half, subnormals included, so only infinities and NaNs need a branch
+//
+inline float halfToFloat(unsigned short h) {
+
+    unsigned x = (h & 0x7fffu) << 13;
+    float f;
+    memcpy(&f, &x, sizeof f);
+    f *= 5.192296858534828e33f;
+    memcpy(&x, &f, sizeof x);
+    if ((h & 0x7c00u) == 0x7c00u)
+        x = 0x7f800000u | (h & 0x3ffu) << 13;
+    x |= (h & 0x8000u) << 16;
+    memcpy(&f, &x, sizeof f);
+
+    return f;
+}
+
+// packNormal packs unit normal n into three signed 10-bit fields
+//
+inline unsigned packNormal(const float* n) {
+
+    unsigned p = 0;
+    for (unsigned k = 0; k < 3; k++) {
+        float c = n[k] < -1 ? -1 : n[k] > 1 ? 1 : n[k];
+        int   q = (int)(c * 511 + (c < 0 ? -0.5f : 0.5f));
+        p |= (q & 0x3ff) << 10 * k;
+    }
+
+    return p;
+}
+
+// unpackNormal unpacks the normal packed in p into n
+//
+inline void unpackNormal(unsigned p, float* n) {
+
+    // shifting each field to the top and back extends its sign
+    for (unsigned k = 0; k < 3; k++)
+        n[k] = ((int)(p << (22 - 10 * k)) >> 22) * (1.0f / 511);
+}
+
+// packVertices packs the n vertices of 8 floats in v - x y z nx ny nz tu tv
+// - into p and stores the bias and scale that decode the positions
+//
+inline void packVertices(const float* v, unsigned n, PackedVertex* p,
+ float* bias, float* scale) {
+
+    float maximum[3];
+    for (unsigned k = 0; k < 3; k++)
+        bias[k] = maximum[k] = n ? v[k] : 0;
+    for (unsigned i = 1; i < n; i++)
+        for (unsigned k = 0; k < 3; k++) {
+            float f = v[8 * i + k];
+            if (f < bias[k])    bias[k]    = f;
+            if (f > maximum[k]) maximum[k] = f;
+        }
+    float inverse[3];
+    for (unsigned k = 0; k < 3; k++) {
+        scale[k]   = (maximum[k] - bias[k]) / 65535;
+        inverse[k] = scale[k] > 0 ? 1 / scale[k] : 0;
+    }
+
+    for (unsigned i = 0; i < n; i++, v += 8, p++) {
+        unsigned short q[3];
+        for (unsigned k = 0; k < 3; k++) {
+            float f = (v[k] - bias[k]) * inverse[k] + 0.5f;
+            q[k] = (unsigned short)(f < 0 ? 0 : f > 65535 ? 65535 : f);
+        }
+        p->x      = q[0];
+        p->y      = q[1];
+        p->z      = q[2];
+        p->tu     = floatToHalf(v[6]);
+        p->tv     = floatToHalf(v[7]);
+        p->unused = 0;
+        p->normal = packNormal(v + 3);
+    }
+}
+
+// unpackVertices decodes the n packed vertices in p into vertices of 8
+// floats in v using the bias and scale stored by packVertices
+//
+inline void unpackVertices(const PackedVertex* p, unsigned n,
+ const float* bias, const float* scale, float* v) {
+
+    for (unsigned i = 0; i < n; i++, p++, v += 8) {
+        v[0] = p->x * scale[0] + bias[0];
+        v[1] = p->y * scale[1] + bias[1];
+        v[2] = p->z * scale[2] + bias[2];
+        unpackNormal(p->normal, v + 3);
+        v[6] = halfToFloat(p->tu);
+        v[7] = halfToFloat(p->tv);
+    }
+}
+
+#endif
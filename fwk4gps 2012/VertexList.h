@@ -1,102 +1,256 @@
-#ifndef _VERTEX_LIST_H_
-#define _VERTEX_LIST_H_
-
-/* Graphic Implementation - Modelling Layer
- *
- * VertexList.h
- * fwk4gps version 3.0
- * gam666/dps901/gam670/dps905
- * January 14 2012
- * copyright (c) 2012 Chris Szalwinski 
- * distributed under TPL - see ../Licenses.txt
- */
-
-#include "Graphic.h"             // for Graphic class definition
-
-//-------------------------------- VertexList ---------------------------------
-//
-// The VertexList class defines the structure of a set of <T> vertices
-//
-template <class T = Vertex>
-class VertexList : public Graphic {
-
-    unsigned     maxNo;         // maximum number of vertices
-    unsigned     no;            // number of vertices stored
-    T*           vertex;        // points to the array of vertices
-    iAPIGraphic* apiVertexList; // points to the API Primitive Set
-
-    virtual ~VertexList() { apiVertexList->Delete(); delete [] vertex; }
-
-  public:
-    VertexList(PrimitiveType, int);
-    VertexList& operator=(const VertexList&);
-    VertexList() : vertex(0), maxNo(0), no(0) { }
-    VertexList(const VertexList& src)         { vertex = 0; *this = src; }
-    void*  clone() const                      { return new VertexList(*this); }
-    int    add(const T& v)                    { if (no < maxNo) vertex[no++] = v; return no; }
-    void   populate(unsigned i, void** pv)    { vertex[i].populate(pv); }
-    Vector position(int i) const              { return vertex[i].position(); }
-    void   render()                           { apiVertexList->draw(no); }
-    void   suspend()                          { apiVertexList->suspend(); }
-    void   release()                          { apiVertexList->release(); }
-    void   Delete() const                     { delete this; }
-};
-
-// CreateVertexList creates a Vertex List object
-//
-template <class T>
-iGraphic* CreateVertexList(PrimitiveType t, int np) {
-
-    return new VertexList<T>(t, np);
-}
-
-// constructor allocates memory for the list and creates the Translation
-//
-template <class T>
-VertexList<T>::VertexList(PrimitiveType t, int np) : no(0) {
-
-    if (np <= 0) {
-        maxNo  = 0;
-        vertex = 0;
-    }
-    else {
-        // Determine the number of vertices for the Primitive Type
-        switch (t) {
-            case POINT_LIST:     maxNo = np;     break;
-            case LINE_LIST:      maxNo = 2 * np; break;
-            case LINE_STRIP:     maxNo = np + 1; break;
-            case TRIANGLE_LIST:  maxNo = 3 * np; break;
-            case TRIANGLE_STRIP: maxNo = np + 2; break;
-            case TRIANGLE_FAN:   maxNo = np + 1; break;
-            default: maxNo = np;
-        }
-        vertex = new T[maxNo];
-    }
-
-    apiVertexList = CreateAPIVertexList(t, np, T::vertexSize(), T::vertexFormat(), (iGraphic*)this);
-}
-
-// assignment operator copies the vertex list and clone the Translation
-//
-template <class T>
-VertexList<T>& VertexList<T>::operator=(const VertexList<T>& src) {
-
-    if (this != &src) {
-        maxNo = src.maxNo;
-        no    = src.no;
-        if (vertex) {
-            delete [] vertex;
-            vertex = 0;
-        }
-         vertex = new T[no];
-         for (unsigned i = 0; i < no; i++)
-             vertex[i] = src.vertex[i];
-        if (apiVertexList)
-            apiVertexList->Delete();
-        apiVertexList = src.apiVertexList->clone();
-    }
-
-    return *this;
-}
-
+#ifndef _VERTEX_LIST_H_
+#define _VERTEX_LIST_H_
+
+/* Graphic Implementation - Modelling Layer
+ *
+ * VertexList.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <cstring>               // for memcpy
+#include "Graphic.h"             // for Graphic class definition
+#include "IndexedVertexList.h"   // for simplify
+
+//-------------------------------- VertexList ---------------------------------
+//
+// The VertexList class defines the structure of a set of <T> vertices -
+// a list and its clones share one array of vertices and one API Primitive
+// Set until one of them changes its vertices
+//
+template <class T = Vertex>
+class VertexList : public Graphic {
+
+    struct Shared {
+        unsigned        refs;    // number of lists sharing the storage
+        T*              vertex;  // points to the array of vertices
+        iAPIGraphic*    api;     // points to the API Primitive Set
+        const iGraphic* user;    // list that the API Primitive Set reads
+    };
+
+    unsigned      maxNo;         // maximum number of vertices
+    unsigned      no;            // number of vertices stored
+    Shared*       shared;        // points to the shared storage
+    PrimitiveType type;          // type of primitive
+    unsigned      nPrimitives;   // number of primitives
+
+    virtual ~VertexList()                     { detach(); }
+    void   bind();
+    void   detach();
+    void   unshare();
+
+  public:
+    VertexList(PrimitiveType, int);
+    VertexList& operator=(const VertexList&);
+    VertexList() : maxNo(0), no(0), shared(nullptr), type(POINT_LIST),
+     nPrimitives(0) { }
+    VertexList(const VertexList& src) : shared(nullptr) { *this = src; }
+    void*  clone() const                      { return new VertexList(*this); }
+    int    add(const T& v);
+    void   upload(void* pv, unsigned n) const { memcpy(pv, shared->vertex, n * sizeof(T)); }
+    Vector position(int i) const              { return shared->vertex[i].position(); }
+    float  bounds(Vector& min, Vector& max, Vector& c) const {
+        return Graphic::bounds(shared ? shared->vertex : nullptr, sizeof(T), 
+         no, min, max, c);
+    }
+    unsigned noIndices() const                { return 0; }
+    unsigned index(unsigned i) const          { return i; }
+    bool   prepare()                          { bind(); return shared->api->prepare(no); }
+    void   render()                           { bind(); shared->api->draw(no); }
+    void   render(const Matrix* w, unsigned n){ bind(); shared->api->draw(no, w, n); }
+    unsigned  noPrimitives() const            { return nPrimitives; }
+    unsigned  batchKey() const;
+    iGraphic* merge(iGraphic* const* g, const Matrix* w, unsigned n) const;
+    iGraphic* simplify(float ratio) const;
+    void   suspend()                          { if (shared) shared->api->suspend(); }
+    void   release()                          { if (shared) shared->api->release(); }
+    void   Delete() const                     { delete this; }
+};
+
+// CreateVertexList creates a Vertex List object
+//
+template <class T>
+iGraphic* CreateVertexList(PrimitiveType t, int np) {
+
+    return new VertexList<T>(t, np);
+}
+
+// constructor allocates memory for the list and creates the Translation
+//
+template <class T>
+VertexList<T>::VertexList(PrimitiveType t, int np) : no(0), type(t),
+ nPrimitives(np > 0 ? np : 0) {
+
+    if (np <= 0)
+        maxNo = 0;
+    else {
+        // Determine the number of vertices for the Primitive Type
+        switch (t) {
+            case POINT_LIST:     maxNo = np;     break;
+            case LINE_LIST:      maxNo = 2 * np; break;
+            case LINE_STRIP:     maxNo = np + 1; break;
+            case TRIANGLE_LIST:  maxNo = 3 * np; break;
+            case TRIANGLE_STRIP: maxNo = np + 2; break;
+            case TRIANGLE_FAN:   maxNo = np + 1; break;
+            default: maxNo = np;
+        }
+    }
+
+    shared         = new Shared;
+    shared->refs   = 1;
+    shared->vertex = maxNo ? new T[maxNo] : 0;
+    shared->api    = CreateAPIVertexList(t, np, T::vertexSize(), 
+     T::vertexFormat(), (iGraphic*)this);
+    shared->user   = this;
+}
+
+// assignment operator shares the storage of the source list - neither list
+// copies the vertices or the Translation until one of them changes
+//
+template <class T>
+VertexList<T>& VertexList<T>::operator=(const VertexList<T>& src) {
+
+    if (this != &src) {
+        detach();
+        maxNo       = src.maxNo;
+        no          = src.no;
+        type        = src.type;
+        nPrimitives = src.nPrimitives;
+        shared      = src.shared;
+        bounded     = false;
+        if (shared) shared->refs++;
+    }
+
+    return *this;
+}
+
+// add adds vertex v to the list, first copying the shared storage if other
+// lists share it - returns the number of vertices
+//
+template <class T>
+int VertexList<T>::add(const T& v) {
+
+    if (no < maxNo) {
+        unshare();
+        shared->vertex[no++] = v;
+        bounded = false;
+    }
+
+    return no;
+}
+
+// bind points the shared Translation at this list before a draw - the
+// Translation reads the vertices from the list that draws it
+//
+template <class T>
+void VertexList<T>::bind() {
+
+    if (shared->user != this) {
+        shared->api->attach((iGraphic*)this);
+        shared->user = this;
+    }
+}
+
+// unshare gives the list its own copy of the shared storage - the other
+// lists keep the original vertices and their buffer
+//
+template <class T>
+void VertexList<T>::unshare() {
+
+    if (shared->refs > 1) {
+        Shared* s = new Shared;
+        s->refs   = 1;
+        s->vertex = maxNo ? new T[maxNo] : 0;
+        for (unsigned i = 0; i < no; i++)
+            s->vertex[i] = shared->vertex[i];
+        s->api    = shared->api->clone();
+        s->api->attach((iGraphic*)this);
+        s->user   = this;
+        detach();
+        shared    = s;
+    }
+}
+
+// detach releases the list's share of the storage - the last list deletes
+// the vertices and the Translation
+//
+template <class T>
+void VertexList<T>::detach() {
+
+    if (shared) {
+        if (--shared->refs == 0) {
+            shared->api->Delete();
+            delete [] shared->vertex;
+            delete shared;
+        }
+        else if (shared->user == this)
+            shared->user = nullptr;
+        shared = nullptr;
+    }
+}
+
+// batchKey identifies the vertex lists that can be merged with this one -
+// lists of the same vertex type and primitive type - 0 if the primitives
+// are connected and cannot be merged
+//
+template <class T>
+unsigned VertexList<T>::batchKey() const {
+
+    return type == POINT_LIST || type == LINE_LIST || type == TRIANGLE_LIST ?
+     T::vertexFormat() << 3 | type : 0;
+}
+
+// merge creates a vertex list that holds the vertices of the n lists g[i]
+// transformed by w[i] - returns nullptr if any list cannot be merged with 
+// this one
+//
+template <class T>
+iGraphic* VertexList<T>::merge(iGraphic* const* g, const Matrix* w, 
+ unsigned n) const {
+
+    unsigned key = batchKey(), np = 0;
+
+    if (!key) return nullptr;
+    for (unsigned i = 0; i < n; i++) {
+        if (!g[i] || g[i]->batchKey() != key)
+            return nullptr;
+        np += ((const VertexList<T>*)g[i])->nPrimitives;
+    }
+
+    VertexList<T>* batch = new VertexList<T>(type, np);
+    for (unsigned i = 0; i < n; i++) {
+        const VertexList<T>* src = (const VertexList<T>*)g[i];
+        Matrix normals = normalTransform(w[i]);
+        for (unsigned k = 0; k < src->no; k++) {
+            T v = src->shared->vertex[k];
+            v.transform(w[i], normals);
+            batch->add(v);
+        }
+    }
+
+    return batch;
+}
+
+// simplify welds the vertices of a triangle list into an indexed list and
+// returns a simplified copy of that list with about ratio of the triangles
+// - returns nullptr if this list is not a triangle list or cannot be
+// reduced
+//
+template <class T>
+iGraphic* VertexList<T>::simplify(float ratio) const {
+
+    if (type != TRIANGLE_LIST || !no) return nullptr;
+
+    IndexedVertexList<T>* welded = new IndexedVertexList<T>(type, no / 3);
+    for (unsigned i = 0; i < no / 3 * 3; i++)
+        welded->add(shared->vertex[i]);
+    iGraphic* lod = welded->simplify(ratio);
+    welded->Delete();
+
+    return lod;
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,149 @@
+/* Workers Implementation - Modelling Layer
+ *
+ * Workers.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "Workers.h"        // for the Workers class definition
+#include "ModellingLayer.h" // for WORKER_THREADS
+
+//-------------------------------- Workers ------------------------------------
+//
+// The Workers object runs slices of per-frame work on its threads
+//
+// the shared pool, the number of its users and the lock that guards them
+static Workers*   shared = nullptr;
+static unsigned   users  = 0;
+static std::mutex attach;
+
+// AttachWorkers returns the shared pool, starting it for the first user
+//
+Workers* AttachWorkers() {
+
+    std::unique_lock<std::mutex> l(attach);
+    if (!users++)
+        shared = new Workers(WORKER_THREADS);
+
+    return shared;
+}
+
+// DetachWorkers stops the shared pool once its last user has detached
+//
+void DetachWorkers() {
+
+    std::unique_lock<std::mutex> l(attach);
+    if (users && !--users) {
+        delete shared;
+        shared = nullptr;
+    }
+}
+
+// constructor starts the worker threads - one less than the number of
+// hardware threads if threads is 0, since the main thread takes slices too
+//
+Workers::Workers(unsigned threads) : next(0), pending(0), stop(false) {
+
+    if (!threads) {
+        threads = std::thread::hardware_concurrency();
+        threads = threads > 1 ? threads - 1 : 0;
+    }
+    for (unsigned i = 0; i < threads; i++)
+        worker.push_back(std::thread(work, this));
+}
+
+// work takes tasks until the pool is stopped - runs on each worker thread
+//
+void Workers::work(Workers* w) {
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> l(w->lock);
+            while (!w->stop && w->next >= w->task.size())
+                w->wake.wait(l);
+            if (w->stop) return;
+        }
+        while (w->execute())
+            ;
+    }
+}
+
+// execute takes the next task of the current run and executes it - returns
+// false if no task was left to take
+//
+bool Workers::execute() {
+
+    WorkerTask t;
+    {
+        std::unique_lock<std::mutex> l(lock);
+        if (next >= task.size()) return false;
+        t = task[next++];
+    }
+    t.function(t.item, t.first, t.last, t.out);
+    std::unique_lock<std::mutex> l(lock);
+    if (!--pending) done.notify_all();
+
+    return true;
+}
+
+// run executes the tasks in t and returns once all of them are done - a
+// single task, or tasks whose run overlaps another thread's, run on the
+// calling thread alone
+//
+void Workers::run(std::vector<WorkerTask>& t) {
+
+    if (t.size() < 2 || worker.empty() || !running.try_lock()) {
+        for (unsigned i = 0; i < t.size(); i++)
+            t[i].function(t[i].item, t[i].first, t[i].last, t[i].out);
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> l(lock);
+        task    = t;
+        next    = 0;
+        pending = t.size();
+    }
+    wake.notify_all();
+    while (execute())
+        ;
+    {
+        std::unique_lock<std::mutex> l(lock);
+        while (pending)
+            done.wait(l);
+    }
+    running.unlock();
+}
+
+// destructor stops and joins the worker threads
+//
+Workers::~Workers() {
+
+    {
+        std::unique_lock<std::mutex> l(lock);
+        stop = true;
+    }
+    wake.notify_all();
+    for (unsigned i = 0; i < worker.size(); i++)
+        worker[i].join();
+}
+
+// slice appends the tasks that process the first n elements of item in
+// slices of size elements
+//
+void slice(std::vector<WorkerTask>& t, void (*function)(void*, unsigned,
+ unsigned, void*), void* item, unsigned n, unsigned size, void* out) {
+
+    for (unsigned first = 0; first < n; first += size) {
+        WorkerTask s;
+        s.function = function;
+        s.item     = item;
+        s.first    = first;
+        s.last     = n - first > size ? first + size : n;
+        s.out      = out;
+        t.push_back(s);
+    }
+}
@@ -0,0 +1,73 @@
+#ifndef _WORKERS_H_
+#define _WORKERS_H_
+
+/* Workers Definition - Modelling Layer
+ *
+ * Workers.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <vector>
+#include <thread>             // for thread
+#include <mutex>              // for mutex, unique_lock
+#include <condition_variable> // for condition_variable
+
+//-------------------------------- Workers ------------------------------------
+//
+// The Workers class runs slices of work - particle updates, skinning and
+// mesh imports - on a pool of threads shared by the items that need it -
+// the calling thread takes slices along with the workers and run returns
+// once every slice is done - a run that starts while another thread's run
+// is in progress executes its slices on its own thread
+//
+// a task calls function with the item that owns the data, the range of
+// elements in its slice and the destination of the slice
+//
+struct WorkerTask {
+    void     (*function)(void* item, unsigned first, unsigned last,
+              void* out);
+    void*    item;  // item that owns the data
+    unsigned first; // first element in the slice
+    unsigned last;  // one past the last element in the slice
+    void*    out;   // destination of the slice - nullptr if none
+};
+
+class Workers {
+
+    std::vector<std::thread> worker;  // worker threads
+    std::mutex               running; // held while task is queued
+    std::mutex               lock;    // guards the members below
+    std::condition_variable  wake;    // signals new tasks or stop
+    std::condition_variable  done;    // signals the last task finished
+    std::vector<WorkerTask>  task;    // tasks of the current run
+    unsigned                 next;    // next task to take
+    unsigned                 pending; // tasks not yet finished
+    bool                     stop;    // workers should exit?
+
+    Workers(const Workers&);
+    Workers& operator=(const Workers&);
+    static void work(Workers* w);
+    bool execute();
+
+  public:
+    Workers(unsigned threads);
+    ~Workers();
+    void run(std::vector<WorkerTask>& t);
+};
+
+// AttachWorkers returns the shared pool and starts it for its first user -
+// DetachWorkers stops it once its last user has detached
+Workers* AttachWorkers();
+
+void DetachWorkers();
+
+// slice appends the tasks that process the first n elements of item in
+// slices of size elements
+void slice(std::vector<WorkerTask>& t, void (*function)(void*, unsigned,
+ unsigned, void*), void* item, unsigned n, unsigned size, void* out);
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef _I_API_MAPPED_FILE_H_
+#define _I_API_MAPPED_FILE_H_
+
+/* APIMappedFile Interface - Translation Layer
+ *
+ * iAPIMappedFile.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+//-------------------------------- iAPIMappedFile -----------------------------
+//
+// iAPIMappedFile is the Interface to the APIMappedFile class
+//
+class iAPIMappedFile {
+  public:
+    virtual const void* data() const = 0;
+    virtual unsigned    size() const = 0;
+	// termination
+    virtual void        Delete() const = 0;
+};
+
+iAPIMappedFile* CreateAPIMappedFile(const wchar_t*);
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef _I_ANIMATION_H_
+#define _I_ANIMATION_H_
+
+/* Animation Interface - Modelling Layer
+ *
+ * iAnimation.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "Base.h" // for the Base class definition
+
+//-------------------------------- iAnimation ---------------------------------
+//
+// iAnimation is the Interface to the Animation class
+//
+class  iFrame;
+struct Vector;
+struct Quaternion;
+
+typedef enum Interpolation {
+    INTERPOLATE_LINEAR, // straight lines between keys - nlerp for rotations
+    INTERPOLATE_NLERP,  // normalized blend of rotations - linear otherwise
+    INTERPOLATE_SLERP,  // rotations at constant speed - linear otherwise
+    INTERPOLATE_CUBIC   // smooth curves through the keys - squad for rotations
+} Interpolation;
+
+class iAnimation : public Base {
+  public:
+	// initialization
+    virtual void  addTranslation(float time, const Vector& t)        = 0;
+    virtual void  addRotation(float time, const Quaternion& q)       = 0;
+    virtual void  addScale(float time, const Vector& s)              = 0;
+    virtual void  setInterpolation(Interpolation translation,
+     Interpolation rotation, Interpolation scale)                     = 0;
+    virtual void  bind(iFrame* f)                                    = 0;
+	// execution
+    virtual void  play(bool loop = true)                             = 0;
+    virtual void  stop()                                             = 0;
+    virtual void  setSpeed(float s)                                  = 0;
+    virtual void  setTime(float t)                                   = 0;
+    virtual bool  isPlaying() const                                  = 0;
+    virtual float duration() const                                   = 0;
+};
+
+iAnimation* CreateAnimation();
+
+iAnimation* Clone(const iAnimation*);
+
+// UpdateAnimations advances the n animations in a by the time since their
+// last update and poses their frames - the coordinator calls it once each
+// frame
+void UpdateAnimations(iAnimation* const* a, unsigned n);
+
+#endif
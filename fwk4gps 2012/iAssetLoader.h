@@ -0,0 +1,103 @@
+#ifndef _I_ASSET_LOADER_H_
+#define _I_ASSET_LOADER_H_
+
+/* AssetLoader Interface - Modelling Layer
+ *
+ * iAssetLoader.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "Base.h" // for the Base class definition
+
+//-------------------------------- iAssetJob ----------------------------------
+//
+// iAssetJob is the Interface to a unit of asynchronous loading work - load
+// runs on a worker thread and may only touch data owned by the job -
+// complete runs on the main thread at a frame boundary and hands the loaded
+// data to its design item
+//
+class iAssetJob {
+  public:
+    virtual bool load()                                             = 0;
+    virtual void complete(bool loaded)                              = 0;
+    virtual void Delete() const                                     = 0;
+};
+
+//-------------------------------- iAssetLoader -------------------------------
+//
+// iAssetLoader is the Interface to the AssetLoader class
+//
+typedef enum AssetState {
+    ASSET_DONE,    // completed, cancelled or unknown
+    ASSET_QUEUED,  // waiting for a worker
+    ASSET_LOADING, // being loaded by a worker
+    ASSET_LOADED   // loaded and waiting for the hand-off
+} AssetState;
+
+struct AssetStats {
+    unsigned queued;         // requests waiting for a worker
+    unsigned loading;        // requests being loaded
+    unsigned waiting;        // requests waiting for the hand-off
+    unsigned completed;      // requests handed off
+    unsigned failed;         // requests whose load failed
+    unsigned averageLatency; // request to hand-off - in system units
+    unsigned maximumLatency; // request to hand-off - in system units
+};
+
+class iAssetLoader : public Base {
+  public:
+    virtual unsigned   request(iAssetJob* job, int priority = 0)    = 0;
+    virtual AssetState state(unsigned handle) const                 = 0;
+    virtual void       reprioritize(unsigned handle, int priority)  = 0;
+    virtual void       cancel(unsigned handle)                      = 0;
+    virtual unsigned   handOff(unsigned max)                        = 0;
+    virtual unsigned   pending() const                              = 0;
+    virtual AssetStats stats() const                                = 0;
+};
+
+iAssetLoader* CreateAssetLoader(unsigned threads);
+
+// readAsset reads the whole of file into a new array and stores its size in
+// size - returns nullptr if the file cannot be read
+unsigned char* readAsset(const wchar_t* file, unsigned& size);
+
+//-------------------------------- FileJob ------------------------------------
+//
+// The FileJob class template reads the whole of a file on a worker thread
+// and hands its contents to item->loaded() at a frame boundary - loaded
+// takes ownership of the contents and receives nullptr if the file could
+// not be read
+//
+template <class T>
+class FileJob : public iAssetJob {
+
+    T*             item; // design item that requested the contents
+    wchar_t*       file; // file with path - owned by the job
+    unsigned char* data; // contents of the file
+    unsigned       size; // size of the contents in bytes
+
+    FileJob(const FileJob&);
+    FileJob& operator=(const FileJob&);
+    virtual ~FileJob() {
+        delete [] file;
+        if (data) delete [] data;
+    }
+
+  public:
+    FileJob(T* i, wchar_t* f) : item(i), file(f), data(nullptr), size(0) {}
+    bool load() {
+        data = readAsset(file, size);
+        return data != nullptr;
+    }
+    void complete(bool) {
+        item->loaded(data, size);
+        data = nullptr;
+    }
+    void Delete() const { delete this; }
+};
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef _I_EMITTER_H_
+#define _I_EMITTER_H_
+
+/* Emitter Interface - Modelling Layer
+ *
+ * iEmitter.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "Frame.h"      // for the Frame class definition
+#include "Base.h"       // for the Base class definition
+
+//-------------------------------- iEmitter -----------------------------------
+//
+// iEmitter is the Interface to the Emitter class
+//
+class  iTexture;
+struct Colour;
+
+class iEmitter : public Frame, public Base {
+  public:
+	// initialization
+    virtual void      attach(iTexture* t)                        = 0;
+    virtual void      setRate(float perSecond)                   = 0;
+    virtual void      setLife(float seconds)                     = 0;
+    virtual void      setSpeed(float minimum, float maximum)     = 0;
+    virtual void      setSpread(float radians)                   = 0;
+    virtual void      setAcceleration(float x, float y, float z) = 0;
+    virtual void      setDrag(float perSecond)                   = 0;
+    virtual void      setSize(float start, float growth)         = 0;
+    virtual void      setColour(const Colour& c)                 = 0;
+	// execution
+    virtual void      emit(unsigned n)                           = 0;
+    virtual unsigned  noParticles() const                        = 0;
+    virtual iTexture* getTexture() const                         = 0;
+};
+
+iEmitter* CreateEmitter(unsigned maxParticles);
+
+// UpdateEmitters advances the n emitters in e by the time since their last
+// update - the coordinator calls it once each frame
+void UpdateEmitters(iEmitter* const* e, unsigned n);
+
+#endif
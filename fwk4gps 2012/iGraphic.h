@@ -1,43 +1,69 @@
-#ifndef _I_GRAPHIC_H_
-#define _I_GRAPHIC_H_
-
-/* Graphic Interface - Modelling Layer
- *
- * iGraphic.h
- * fwk4gps version 3.0
- * gam666/dps901/gam670/dps905
- * January 14 2012
- * copyright (c) 2012 Chris Szalwinski 
- * distributed under TPL - see ../Licenses.txt
- */
-
-#include "Base.h"       // for the Base class definition
-
-//-------------------------------- iGraphic ------------------------------
-//
-// iGraphic is the Interface to the Graphic hierarchy
-//
-struct Vector;
-enum PrimitiveType;
-struct Colour;
-
-class iGraphic : public Base {
-  public:
-    virtual void   populate(unsigned, void**)                    = 0;
-    virtual Vector position(int) const                           = 0;
-    virtual void   render()                                      = 0;
-};
-
-iGraphic* CreateBox(float minx, float miny, float minz, float maxx, 
- float maxy, float maxz);
-
-iGraphic* CreateGrid(float min, float max, int n);
-
-iGraphic* TriangleList(const wchar_t* file);
-
-iGraphic* TriangleList(const wchar_t* file, const Colour&);
-
-iGraphic* CreateRectangleList(float minx, float miny, float maxx, 
- float maxy);
-
-#endif
+#ifndef _I_GRAPHIC_H_
+#define _I_GRAPHIC_H_
+
+/* Graphic Interface - Modelling Layer
+ *
+ * iGraphic.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "Base.h"       // for the Base class definition
+
+//-------------------------------- iGraphic ------------------------------
+//
+// iGraphic is the Interface to the Graphic hierarchy
+//
+struct Vector;
+struct Matrix;
+enum PrimitiveType;
+struct Colour;
+
+class iGraphic : public Base {
+  public:
+    virtual void   upload(void*, unsigned) const                 = 0;
+    virtual bool   prepare()                                     = 0;
+    virtual Vector position(int) const                           = 0;
+    virtual float  bounds(Vector& minimum, Vector& maximum,
+     Vector& centre) const                                       = 0;
+    virtual unsigned noIndices() const                           = 0;
+    virtual unsigned index(unsigned) const                       = 0;
+    virtual void   render()                                      = 0;
+    virtual void   render(const Matrix* world, unsigned n)       = 0;
+    virtual unsigned  noPrimitives() const                       = 0;
+    virtual unsigned  batchKey() const                           = 0;
+    virtual iGraphic* merge(iGraphic* const* g, const Matrix* w,
+     unsigned n) const                                           = 0;
+    virtual iGraphic* simplify(float ratio) const                = 0;
+};
+
+iGraphic* CreateBox(float minx, float miny, float minz, float maxx, 
+ float maxy, float maxz);
+
+iGraphic* CreateGrid(float min, float max, int n);
+
+iGraphic* TriangleList(const wchar_t* file);
+
+iGraphic* TriangleList(const wchar_t* file, const Colour&);
+
+iGraphic* LoadTriangleList(const wchar_t* file, int priority = 0);
+
+iGraphic* Mesh(const wchar_t* file);
+
+iGraphic* Mesh(const wchar_t* file, const Colour&);
+
+iGraphic* PackedTriangleList(const wchar_t* file);
+
+iGraphic* PackedMesh(const wchar_t* file);
+
+iGraphic* ObjMesh(const wchar_t* file, unsigned threads = 1);
+
+iGraphic* PlyMesh(const wchar_t* file, unsigned threads = 1);
+
+iGraphic* CreateRectangleList(float minx, float miny, float maxx, 
+ float maxy);
+
+#endif
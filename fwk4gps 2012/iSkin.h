@@ -0,0 +1,40 @@
+#ifndef _I_SKIN_H_
+#define _I_SKIN_H_
+
+/* Skin Interface - Modelling Layer
+ *
+ * iSkin.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "iGraphic.h"  // for the Graphic Interface
+#include "Skinning.h"  // for SkinVertex
+
+//-------------------------------- iSkin --------------------------------------
+//
+// iSkin is the Interface to the Skin class
+//
+typedef enum Skinning {
+    SKIN_LINEAR,         // blends the joint matrices
+    SKIN_DUAL_QUATERNION // blends the joint dual quaternions - rigid joints
+} Skinning;
+
+class iFrame;
+
+class iSkin : public iGraphic {
+  public:
+    virtual void     bind(iFrame* root, iFrame* const* joint,
+     unsigned n)                                                 = 0;
+    virtual void     setSkinning(Skinning s)                     = 0;
+    virtual Skinning skinning() const                            = 0;
+    virtual unsigned noJoints() const                            = 0;
+};
+
+iSkin* CreateSkin(const SkinVertex* v, unsigned nv,
+ const unsigned* index = nullptr, unsigned ni = 0);
+
+#endif
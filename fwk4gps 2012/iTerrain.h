@@ -0,0 +1,32 @@
+#ifndef _I_TERRAIN_H_
+#define _I_TERRAIN_H_
+
+/* Terrain Interface - Modelling Layer
+ *
+ * iTerrain.h
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include "iGraphic.h"   // for the Graphic Interface
+
+//-------------------------------- iTerrain -----------------------------------
+//
+// iTerrain is the Interface to the Terrain class
+//
+class iTerrain : public iGraphic {
+  public:
+    virtual float    height(float x, float z) const              = 0;
+    virtual Vector   normal(float x, float z) const              = 0;
+    virtual bool     contains(float x, float z) const            = 0;
+    virtual unsigned noResident() const                          = 0;
+};
+
+iTerrain* CreateTerrain(const wchar_t* file, float spacing, float scale);
+
+iTerrain* CreateTerrain(const float* height, unsigned n, float spacing);
+
+#endif
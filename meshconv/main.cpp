@@ -0,0 +1,671 @@
+/* Mesh Converter - Offline Tool
+ *
+ * main.cpp
+ * fwk4gps version 3.0
+ * gam666/dps901/gam670/dps905
+ * January 14 2012
+ * copyright (c) 2012 Chris Szalwinski 
+ * distributed under TPL - see ../Licenses.txt
+ */
+
+#include <cstdio>
+#include <cstdlib>                       // for atof
+#include <cstring>                       // for strcmp, memset
+#include <ctime>                         // for clock
+#include <fstream>
+#include <map>
+#include <vector>
+#include "../fwk4gps 2012/MeshOptimizer.h" // for the optimizer functions
+#include "../fwk4gps 2012/MeshFile.h"      // for the binary mesh format
+#include "../fwk4gps 2012/FloatReader.h"   // for the FloatReader class
+#include "../fwk4gps 2012/VertexCodec.h"   // for the packed vertex format
+#include "../fwk4gps 2012/Skinning.h"      // for the skinning functions
+#include "../fwk4gps 2012/MathDefinitions.h" // for the quaternion functions
+#include "../fwk4gps 2012/QuaternionBatch.h" // for the batch functions
+
+// meshconv reads a triangle list in the text format that the framework's
+// TriangleList functions read, welds the identical vertices, optimizes the
+// triangle order and writes the triangle list back in the same format or
+// in the binary mesh format that the framework's Mesh functions map -
+// optionally it first simplifies the mesh to bake a level of detail
+//
+//    meshconv [-c] [-n] [-b] [-s ratio] input output
+//    meshconv [-c] -t input
+//    meshconv -k input
+//    meshconv -q [count]
+//
+//    -c  records are coloured vertices - x y z
+//        otherwise records are textured vertices - x y z nx ny nz tu tv
+//    -n  skip overdraw ordering
+//    -b  write the binary mesh format
+//    -s  keep about ratio (0 to 1) of the triangles
+//    -t  time the stream loader against the block loader on input and,
+//        for textured vertices, the packed upload against the plain copy
+//    -k  time the linear blend and dual quaternion skinning of the textured
+//        vertices in input on a single core
+//    -q  check the quaternion functions against the matrix functions and
+//        the batch functions against the single ones on count random
+//        rotations (default 1048576) and time each
+//
+static void usage() {
+
+    printf("usage: meshconv [-c] [-n] [-b] [-s ratio] input output\n");
+    printf("       meshconv [-c] -t input\n");
+    printf("       meshconv -k input\n");
+    printf("       meshconv -q [count]\n");
+    printf("  -c  records hold x y z only (coloured vertices)\n");
+    printf("  -n  skip overdraw ordering\n");
+    printf("  -b  write the binary mesh format\n");
+    printf("  -s  keep about ratio (0 to 1) of the triangles\n");
+    printf("  -t  time the text loaders on input\n");
+    printf("  -k  time skinning the vertices of input on one core\n");
+    printf("  -q  check and time the quaternion functions\n");
+}
+
+// benchmark times the two-pass wide stream parse that the framework's text
+// loaders used against the single-pass block parse that they use now - for
+// textured vertices it also compares the memory held by the vertices and
+// the time to upload them in plain and in packed form
+//
+static void benchmark(const char* input, unsigned nFloats) {
+
+    float f[8];
+    unsigned no = 0;
+
+    // two passes through a locale-aware wide stream
+    clock_t start = clock();
+    {
+        std::wifstream in(input, std::ios::in);
+        float xc = 0, yc = 0, zc = 0;
+        for (;;) {
+            unsigned k = 0;
+            while (k < nFloats && in >> f[k])
+                k++;
+            if (k < nFloats) break;
+            xc += f[0];
+            yc += f[1];
+            zc += f[2];
+            no++;
+        }
+        in.clear();
+        in.seekg(0);
+        std::vector<float> record(no * nFloats);
+        for (unsigned i = 0; i < no * nFloats; i++)
+            in >> record[i];
+    }
+    double stream = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    // one pass through fixed blocks
+    start = clock();
+    unsigned nb = 0;
+    {
+        FloatReader in(input);
+        std::vector<float> record;
+        record.reserve(in.size() / 5);
+        double xc = 0, yc = 0, zc = 0;
+        while (in.read(f, nFloats)) {
+            record.insert(record.end(), f, f + nFloats);
+            xc += f[0];
+            yc += f[1];
+            zc += f[2];
+            nb++;
+        }
+    }
+    double block = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("%s: %u records\n", input, no);
+    printf("  wide stream, two passes  %8.3f s\n", stream);
+    printf("  block reader, one pass   %8.3f s (%u records)\n", block, nb);
+    if (block > 0)
+        printf("  speedup                  %8.1fx\n", stream / block);
+
+    if (nFloats == 8 && nb) {
+        // every record as a vertex - the upload copies into a scratch buffer
+        // in place of a locked vertex buffer
+        FloatReader in(input);
+        std::vector<float> vertex(nb * 8), buffer(nb * 8);
+        for (unsigned i = 0; i < nb && in.read(&vertex[i * 8], 8); i++)
+            ;
+        std::vector<PackedVertex> packed(nb);
+        float bias[3], scale[3];
+        start = clock();
+        packVertices(&vertex[0], nb, &packed[0], bias, scale);
+        double encode = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        const unsigned passes = 10;
+        start = clock();
+        for (unsigned k = 0; k < passes; k++)
+            memcpy(&buffer[0], &vertex[0], nb * 8 * sizeof(float));
+        double plain = (double)(clock() - start) / CLOCKS_PER_SEC / passes;
+        start = clock();
+        for (unsigned k = 0; k < passes; k++)
+            unpackVertices(&packed[0], nb, bias, scale, &buffer[0]);
+        double unpack = (double)(clock() - start) / CLOCKS_PER_SEC / passes;
+
+        float error = 0;
+        for (unsigned i = 0; i < nb * 8; i++) {
+            float e = buffer[i] - vertex[i];
+            if (e < 0) e = -e;
+            if (e > error && i % 8 < 3) error = e;
+        }
+        printf("  vertices, plain          %8u bytes\n", nb * 32);
+        printf("  vertices, packed         %8u bytes\n", 
+         nb * (unsigned)sizeof(PackedVertex));
+        printf("  encode                   %8.3f s\n", encode);
+        printf("  upload, plain copy       %8.4f s\n", plain);
+        printf("  upload, packed decode    %8.4f s\n", unpack);
+        printf("  largest position error   %8.6f\n", error);
+    }
+}
+
+// skinBenchmark times skinning the textured vertices in input on a single
+// core - the vertices are bound to a chain of joints along their y extent,
+// each to the two nearest joints and more lightly to the next two, and the
+// joints are bent progressively along the chain
+//
+static void skinBenchmark(const char* input) {
+
+    const unsigned nJoints = 32, passes = 10;
+    FloatReader in(input);
+    std::vector<SkinVertex> vertex;
+    float f[8], minY = 0, maxY = 0;
+    while (in.read(f, 8)) {
+        SkinVertex v;
+        memset(&v, 0, sizeof v);
+        memcpy(&v, f, sizeof f);
+        if (vertex.empty() || f[1] < minY) minY = f[1];
+        if (vertex.empty() || f[1] > maxY) maxY = f[1];
+        vertex.push_back(v);
+    }
+    unsigned n = vertex.size();
+    if (!n) {
+        printf("meshconv: %s holds no textured vertices\n", input);
+        return;
+    }
+    float range = maxY > minY ? maxY - minY : 1;
+    for (unsigned i = 0; i < n; i++) {
+        SkinVertex& v = vertex[i];
+        float    t = (v.y - minY) / range * (nJoints - 1);
+        unsigned b = t < nJoints - 1 ? (unsigned)t : nJoints - 2;
+        float    u = t - b;
+        v.joint[0]  = (unsigned char)b;
+        v.joint[1]  = (unsigned char)(b + 1);
+        v.joint[2]  = (unsigned char)(b ? b - 1 : 0);
+        v.joint[3]  = (unsigned char)(b + 2 < nJoints ? b + 2 : b + 1);
+        v.weight[0] = 0.8f * (1 - u);
+        v.weight[1] = 0.8f * u;
+        v.weight[2] = 0.1f;
+        v.weight[3] = 0.1f;
+    }
+
+    // joint k turns by 0.05 k radians about an axis tilted from z and moves
+    // along the chain
+    std::vector<float> matrices(16 * nJoints), dual(8 * nJoints);
+    for (unsigned k = 0; k < nJoints; k++) {
+        float a = 0.025f * k, s = sinf(a), l = sqrtf(1.09f);
+        float x = 0.3f * s / l, y = 0, z = s / l, w = cosf(a);
+        float tx = 0.01f * k * range, ty = 0, tz = 0.005f * k * range;
+        float* m = &matrices[16 * k];
+        m[0]  = 1 - 2 * (y * y + z * z); m[1] = 2 * (x * y + w * z);
+        m[2]  = 2 * (x * z - w * y);     m[3] = 0;
+        m[4]  = 2 * (x * y - w * z);     m[5] = 1 - 2 * (x * x + z * z);
+        m[6]  = 2 * (y * z + w * x);     m[7] = 0;
+        m[8]  = 2 * (x * z + w * y);     m[9] = 2 * (y * z - w * x);
+        m[10] = 1 - 2 * (x * x + y * y); m[11] = 0;
+        m[12] = tx; m[13] = ty; m[14] = tz; m[15] = 0;
+        dualQuaternion(x, y, z, w, tx, ty, tz, &dual[8 * k]);
+    }
+
+    std::vector<float> linear(8 * n), blended(8 * n);
+    clock_t start = clock();
+    for (unsigned p = 0; p < passes; p++)
+        skinLinear(&vertex[0], n, &matrices[0], &linear[0]);
+    double lbs = (double)(clock() - start) / CLOCKS_PER_SEC / passes;
+    start = clock();
+    for (unsigned p = 0; p < passes; p++)
+        skinDualQuaternion(&vertex[0], n, &dual[0], &blended[0]);
+    double dqs = (double)(clock() - start) / CLOCKS_PER_SEC / passes;
+
+    float difference = 0;
+    for (unsigned i = 0; i < 8 * n; i++) {
+        float e = linear[i] - blended[i];
+        if (e < 0) e = -e;
+        if (e > difference && i % 8 < 3) difference = e;
+    }
+    printf("%s: %u vertices, %u joints\n", input, n, nJoints);
+    if (lbs > 0)
+        printf("  linear blend            %8.2f M vertices/s per core\n",
+         n / lbs / 1e6);
+    if (dqs > 0)
+        printf("  dual quaternion         %8.2f M vertices/s per core\n",
+         n / dqs / 1e6);
+    printf("  largest difference      %8.6f\n", difference);
+}
+
+// QuaternionSet holds n quaternions both singly and as the component
+// arrays that the batch functions process
+//
+struct QuaternionSet {
+    std::vector<Quaternion> q;
+    std::vector<float>      c[4];
+    QuaternionSet(unsigned n) : q(n) {
+        for (unsigned k = 0; k < 4; k++)
+            c[k].resize(n);
+    }
+    void set(unsigned i, const Quaternion& r) {
+        q[i]    = r;
+        c[0][i] = r.x;
+        c[1][i] = r.y;
+        c[2][i] = r.z;
+        c[3][i] = r.w;
+    }
+    QuaternionArrays arrays() {
+        QuaternionArrays a = { &c[0][0], &c[1][0], &c[2][0], &c[3][0] };
+        return a;
+    }
+};
+
+// uniform returns a random number between -1 and 1
+//
+static float uniform() {
+
+    return 2.0f * rand() / RAND_MAX - 1;
+}
+
+// largest returns the largest difference between the components of the
+// batch results in r and the single results in q
+//
+static float largest(const QuaternionSet& r,
+ const std::vector<Quaternion>& q) {
+
+    float e = 0;
+    for (unsigned i = 0; i < q.size(); i++) {
+        const float* a = &q[i].x;
+        for (unsigned k = 0; k < 4; k++) {
+            float d = r.c[k][i] - a[k];
+            if (d < 0) d = -d;
+            if (!(d <= e)) e = d;
+        }
+    }
+    return e;
+}
+
+// largest returns the largest difference between the elements of a and b
+//
+static float largest(const Matrix& a, const Matrix& b) {
+
+    const float* p = &a.m11;
+    const float* q = &b.m11;
+    float e = 0;
+    for (unsigned k = 0; k < 16; k++) {
+        float d = p[k] - q[k];
+        if (d < 0) d = -d;
+        if (!(d <= e)) e = d;
+    }
+    return e;
+}
+
+// rate returns the millions of items per second for passes over n items
+// since start
+//
+static double rate(unsigned n, clock_t start, unsigned passes) {
+
+    double s = (double)(clock() - start) / CLOCKS_PER_SEC / passes;
+    return s > 0 ? n / s / 1e6 : 0;
+}
+
+// quaternionBenchmark checks the quaternion functions against the matrix
+// functions that they replace and the batch functions against the single
+// quaternion functions on n random rotations, and times each path - one
+// pair of squad controls is opposite, where the controls blend through a
+// zero midpoint
+//
+static void quaternionBenchmark(unsigned n) {
+
+    const unsigned passes = 10;
+    srand(1);
+    QuaternionSet a(n), b(n), sa(n), sb(n), r(n);
+    std::vector<float> t(n), vx(n), vy(n), vz(n), rx(n), ry(n), rz(n);
+    std::vector<Vector> axis(n);
+    std::vector<float> radians(n);
+    for (unsigned i = 0; i < n; i++) {
+        axis[i]    = normal(Vector(uniform(), uniform(), uniform()));
+        radians[i] = 3.1f * uniform();
+        a.set(i, quaternion(axis[i], radians[i]));
+        b.set(i, normal(Quaternion(uniform(), uniform(), uniform(),
+         uniform())));
+        sa.set(i, normal(Quaternion(uniform(), uniform(), uniform(),
+         uniform())));
+        sb.set(i, i ? normal(Quaternion(uniform(), uniform(), uniform(),
+         uniform())) : Quaternion(-sa.q[0].x, -sa.q[0].y, -sa.q[0].z,
+         -sa.q[0].w));
+        t[i]  = 0.5f * (uniform() + 1);
+        vx[i] = 10 * uniform();
+        vy[i] = 10 * uniform();
+        vz[i] = 10 * uniform();
+    }
+    QuaternionArrays qa = a.arrays(), qb = b.arrays(), qsa = sa.arrays(),
+     qsb = sb.arrays(), qr = r.arrays();
+
+    // the quaternion functions against the matrix functions
+    float eRotate = 0, eVector = 0, eEuler = 0;
+    for (unsigned i = 0; i < n; i++) {
+        Matrix m = rotate(axis[i], radians[i]);
+        float e = largest(rotate(a.q[i]), m);
+        if (e > eRotate) eRotate = e;
+        Vector v(vx[i], vy[i], vz[i]);
+        e = (v * a.q[i] - v * m).length();
+        if (e > eVector) eVector = e;
+        float ax = 3 * uniform(), ay = 1.5f * uniform(), az = 3 * uniform();
+        Matrix s(1);
+        s.rotatex(ax);
+        s.rotatey(ay);
+        s.rotatez(az);
+        e = largest(rotate(quaternion(ax, ay, az)), s);
+        if (e > eEuler) eEuler = e;
+    }
+
+    // the batch functions against the single functions
+    std::vector<Quaternion> q(n);
+    for (unsigned i = 0; i < n; i++)
+        q[i] = a.q[i] * b.q[i];
+    multiply(qa, qb, qr, n);
+    float eMultiply = largest(r, q);
+    for (unsigned i = 0; i < n; i++)
+        q[i] = nlerp(a.q[i], b.q[i], t[i]);
+    nlerp(qa, qb, &t[0], qr, n);
+    float eNlerp = largest(r, q);
+    for (unsigned i = 0; i < n; i++)
+        q[i] = slerp(a.q[i], b.q[i], t[i]);
+    slerp(qa, qb, &t[0], qr, n);
+    float eSlerp = largest(r, q);
+    for (unsigned i = 0; i < n; i++)
+        q[i] = squad(a.q[i], b.q[i], sa.q[i], sb.q[i], t[i]);
+    squad(qa, qb, qsa, qsb, &t[0], qr, n);
+    float eSquad = largest(r, q);
+    rotate(&vx[0], &vy[0], &vz[0], qa, &rx[0], &ry[0], &rz[0], n);
+    float eBatch = 0;
+    for (unsigned i = 0; i < n; i++) {
+        float e = (Vector(vx[i], vy[i], vz[i]) * a.q[i] -
+         Vector(rx[i], ry[i], rz[i])).length();
+        if (!(e <= eBatch)) eBatch = e;
+    }
+
+    printf("%u random rotations, %d lanes\n", n, QUATERNION_LANES);
+    printf("  largest difference\n");
+    printf("    %-34s %10.2e\n", "rotate(q), rotate(axis, a)", eRotate);
+    printf("    %-34s %10.2e\n", "v * q, v * rotate(axis, a)", eVector);
+    printf("    %-34s %10.2e\n", "quaternion(x, y, z), rotatex/y/z",
+     eEuler);
+    printf("    %-34s %10.2e\n", "batch, single multiply", eMultiply);
+    printf("    %-34s %10.2e\n", "batch, single rotate", eBatch);
+    printf("    %-34s %10.2e\n", "batch, single nlerp", eNlerp);
+    printf("    %-34s %10.2e\n", "batch, single slerp", eSlerp);
+    printf("    %-34s %10.2e\n", "batch, single squad", eSquad);
+
+    // throughput
+    clock_t start = clock();
+    for (unsigned p = 0; p < passes; p++)
+        for (unsigned i = 0; i < n; i++) {
+            Vector v = Vector(vx[i], vy[i], vz[i]) * rotate(a.q[i]);
+            rx[i] = v.x;
+            ry[i] = v.y;
+            rz[i] = v.z;
+        }
+    double rMatrix = rate(n, start, passes);
+    start = clock();
+    for (unsigned p = 0; p < passes; p++)
+        for (unsigned i = 0; i < n; i++) {
+            Vector v = Vector(vx[i], vy[i], vz[i]) * a.q[i];
+            rx[i] = v.x;
+            ry[i] = v.y;
+            rz[i] = v.z;
+        }
+    double rSingle = rate(n, start, passes);
+    start = clock();
+    for (unsigned p = 0; p < passes; p++)
+        rotate(&vx[0], &vy[0], &vz[0], qa, &rx[0], &ry[0], &rz[0], n);
+    double rBatch = rate(n, start, passes);
+
+    std::vector<Matrix> m(n);
+    start = clock();
+    for (unsigned p = 0; p < passes; p++)
+        for (unsigned i = 0; i < n; i++)
+            m[i] = rotate(axis[i], t[i] * radians[i]);
+    double iMatrix = rate(n, start, passes);
+    double iSingle[3], iBatch[3];
+    for (unsigned f = 0; f < 3; f++) {
+        start = clock();
+        for (unsigned p = 0; p < passes; p++)
+            for (unsigned i = 0; i < n; i++)
+                q[i] = f == 0 ? nlerp(a.q[i], b.q[i], t[i]) :
+                       f == 1 ? slerp(a.q[i], b.q[i], t[i]) :
+                       squad(a.q[i], b.q[i], sa.q[i], sb.q[i], t[i]);
+        iSingle[f] = rate(n, start, passes);
+        start = clock();
+        for (unsigned p = 0; p < passes; p++)
+            if (f == 0)
+                nlerp(qa, qb, &t[0], qr, n);
+            else if (f == 1)
+                slerp(qa, qb, &t[0], qr, n);
+            else
+                squad(qa, qb, qsa, qsb, &t[0], qr, n);
+        iBatch[f] = rate(n, start, passes);
+    }
+
+    printf("  M per second                 single      batch\n");
+    printf("    rotate vector by matrix %10.1f\n", rMatrix);
+    printf("    rotate vector           %10.1f %10.1f\n", rSingle, rBatch);
+    printf("    rotate(axis, t * a)     %10.1f\n", iMatrix);
+    printf("    nlerp                   %10.1f %10.1f\n", iSingle[0],
+     iBatch[0]);
+    printf("    slerp                   %10.1f %10.1f\n", iSingle[1],
+     iBatch[1]);
+    printf("    squad                   %10.1f %10.1f\n", iSingle[2],
+     iBatch[2]);
+}
+
+// writeBinary writes the welded vertices and the indices to file output in
+// the binary mesh format - the vertices are renumbered in order of first
+// use and the positions are centred on the centroid of the records as the
+// text loaders do - returns false if the file cannot be written
+//
+static bool writeBinary(const char* output, unsigned nFloats,
+ const std::vector<std::vector<float> >& vertex, std::vector<unsigned>& index) {
+
+    unsigned nIndices = index.size(), nVertices = vertex.size();
+    MeshHeader h;
+    memset(&h, 0, sizeof h);
+
+    // centroid of the records
+    for (unsigned i = 0; i < nIndices; i++)
+        for (unsigned k = 0; k < 3; k++)
+            h.centroid[k] += vertex[index[i]][k];
+    for (unsigned k = 0; k < 3; k++)
+        h.centroid[k] /= nIndices;
+
+    std::vector<unsigned> remap(nVertices);
+    nVertices = optimizeVertexFetch(&index[0], nIndices, nVertices,
+     &remap[0]);
+    h.magic      = MESH_MAGIC;
+    h.version    = MESH_VERSION;
+    h.headerSize = sizeof(MeshHeader);
+    h.attributes = nFloats == 8 ? MESH_VERTEX : MESH_POSITIONS;
+    h.vertexSize = nFloats * sizeof(float);
+    h.nVertices  = nVertices;
+    h.indexSize  = nVertices <= 0x10000 ? 2 : 4;
+    h.nIndices   = nIndices;
+
+    // vertex blob in order of first use
+    std::vector<float> blob(nVertices * nFloats);
+    for (unsigned v = 0; v < vertex.size(); v++) {
+        if (remap[v] >= nVertices) continue;
+        float* f = &blob[remap[v] * nFloats];
+        for (unsigned k = 0; k < nFloats; k++)
+            f[k] = vertex[v][k];
+        for (unsigned k = 0; k < 3; k++)
+            f[k] -= h.centroid[k];
+    }
+    for (unsigned k = 0; k < 3; k++)
+        h.minimum[k] = h.maximum[k] = blob[k];
+    for (unsigned v = 1; v < nVertices; v++)
+        for (unsigned k = 0; k < 3; k++) {
+            float f = blob[v * nFloats + k];
+            if (f < h.minimum[k]) h.minimum[k] = f;
+            if (f > h.maximum[k]) h.maximum[k] = f;
+        }
+
+    h.vertexOffset = meshAlign(sizeof(MeshHeader));
+    h.indexOffset  = meshAlign(h.vertexOffset + nVertices * h.vertexSize);
+    h.fileSize     = h.indexOffset + nIndices * h.indexSize;
+
+    std::vector<unsigned char> file(h.fileSize, 0);
+    memcpy(&file[0], &h, sizeof h);
+    memcpy(&file[h.vertexOffset], &blob[0], nVertices * h.vertexSize);
+    if (h.indexSize == 4)
+        memcpy(&file[h.indexOffset], &index[0], nIndices * 4);
+    else {
+        unsigned short* s = (unsigned short*)&file[h.indexOffset];
+        for (unsigned i = 0; i < nIndices; i++)
+            s[i] = (unsigned short)index[i];
+    }
+
+    std::ofstream out(output, std::ios::out | std::ios::binary);
+    if (!out) return false;
+    out.write((const char*)&file[0], file.size());
+
+    return !out.fail();
+}
+
+int main(int argc, char* argv[]) {
+
+    unsigned nFloats = 8;
+    bool overdraw = true;
+    bool binary = false;
+    bool timing = false;
+    bool skinning = false;
+    bool quaternions = false;
+    float ratio = 1;
+    const char* input = 0;
+    const char* output = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-c"))
+            nFloats = 3;
+        else if (!strcmp(argv[i], "-n"))
+            overdraw = false;
+        else if (!strcmp(argv[i], "-b"))
+            binary = true;
+        else if (!strcmp(argv[i], "-t"))
+            timing = true;
+        else if (!strcmp(argv[i], "-k"))
+            skinning = true;
+        else if (!strcmp(argv[i], "-q"))
+            quaternions = true;
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+            ratio = (float)atof(argv[++i]);
+        else if (!input)
+            input = argv[i];
+        else if (!output)
+            output = argv[i];
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if (quaternions && !output) {
+        int n = input ? atoi(input) : 0;
+        quaternionBenchmark(n > 0 ? n : 1 << 20);
+        return 0;
+    }
+    if (skinning && input && !output) {
+        skinBenchmark(input);
+        return 0;
+    }
+    if (timing && input && !output) {
+        benchmark(input, nFloats);
+        return 0;
+    }
+    if (!input || !output) {
+        usage();
+        return 1;
+    }
+
+    FloatReader in(input);
+    if (!in.isOpen()) {
+        printf("meshconv: unable to open %s\n", input);
+        return 2;
+    }
+
+    // read complete records, welding identical vertices
+    std::map<std::vector<float>, unsigned> weld;
+    std::vector<std::vector<float> > vertex;
+    std::vector<unsigned> index;
+    std::vector<float> record(nFloats);
+    while (in.read(&record[0], nFloats)) {
+        std::map<std::vector<float>, unsigned>::iterator it =
+         weld.find(record);
+        if (it == weld.end()) {
+            it = weld.insert(std::make_pair(record,
+             (unsigned)vertex.size())).first;
+            vertex.push_back(record);
+        }
+        index.push_back(it->second);
+    }
+    index.resize(index.size() / 3 * 3);
+    if (index.empty()) {
+        printf("meshconv: %s holds no complete triangles\n", input);
+        return 2;
+    }
+
+    unsigned nIndices = index.size(), nVertices = vertex.size();
+    std::vector<float> position(3 * nVertices);
+    for (unsigned v = 0; v < nVertices; v++)
+        for (unsigned k = 0; k < 3; k++)
+            position[3 * v + k] = vertex[v][k];
+    if (ratio > 0 && ratio < 1) {
+        unsigned target = (unsigned)(nIndices / 3 * ratio) * 3;
+        unsigned n = simplify(&index[0], nIndices, &position[0],
+         3 * sizeof(float), nVertices, target > 3 ? target : 3);
+        printf("%s: simplified %u triangles to %u\n", input, nIndices / 3,
+         n / 3);
+        index.resize(n);
+        nIndices = n;
+    }
+    float before = acmr(&index[0], nIndices);
+    optimizeVertexCache(&index[0], nIndices, nVertices);
+    if (overdraw)
+        optimizeOverdraw(&index[0], nIndices, &position[0],
+         3 * sizeof(float), nVertices);
+    float after = acmr(&index[0], nIndices);
+
+    if (binary) {
+        if (!writeBinary(output, nFloats, vertex, index)) {
+            printf("meshconv: unable to create %s\n", output);
+            return 2;
+        }
+    }
+    else {
+        // write the triangles in their new order - the framework's weld
+        // numbers the vertices in order of first use, which preserves the
+        // fetch order
+        std::ofstream out(output);
+        if (!out) {
+            printf("meshconv: unable to create %s\n", output);
+            return 2;
+        }
+        out.precision(9);
+        for (unsigned i = 0; i < nIndices; i++) {
+            const std::vector<float>& v = vertex[index[i]];
+            for (unsigned k = 0; k < nFloats; k++)
+                out << (k ? " " : "") << v[k];
+            out << '\n';
+        }
+    }
+
+    printf("%s: %u triangles, %u vertices\n", input, nIndices / 3, nVertices);
+    printf("ACMR (FIFO %u) before %.3f after %.3f\n", VERTEX_CACHE_SIZE,
+     before, after);
+
+    return 0;
+}